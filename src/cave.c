@@ -149,6 +149,9 @@ struct chunk *cave_new(int height, int width) {
 	c->obj_max = OBJECT_LIST_SIZE - 1;
 
 	c->monsters = mem_zalloc(z_info->level_monster_max *sizeof(struct monster));
+	c->monsters_known = mem_zalloc(z_info->level_monster_max *
+								   sizeof(struct monster_known));
+	c->mon_free = mem_zalloc(z_info->level_monster_max * sizeof(u16b));
 	c->mon_max = 1;
 	c->mon_current = -1;
 
@@ -176,13 +179,42 @@ void cave_free(struct chunk *c) {
 
 	mem_free(c->feat_count);
 	mem_free(c->objects);
+	mem_free(c->obj_timed);
 	mem_free(c->monsters);
+	mem_free(c->monsters_known);
+	mem_free(c->mon_free);
+	mem_free(c->trap_timed);
 	if (c->name)
 		string_free(c->name);
 	mem_free(c);
 }
 
 
+/**
+ * Remember that a listed object can recharge, so that process_world() need
+ * not search the whole object list for such objects
+ */
+static void list_timed_object(struct chunk *c, struct object *obj)
+{
+	int i;
+
+	if (!tval_can_have_timeout(obj)) return;
+
+	/* The slot may have held another such object */
+	for (i = 0; i < c->obj_timed_num; i++)
+		if (c->obj_timed[i] == obj->oidx)
+			return;
+
+	/* Extend the list */
+	if (c->obj_timed_num == c->obj_timed_max) {
+		c->obj_timed_max += OBJECT_LIST_INCR;
+		c->obj_timed = mem_realloc(c->obj_timed,
+								   c->obj_timed_max * sizeof(u16b));
+	}
+
+	c->obj_timed[c->obj_timed_num++] = obj->oidx;
+}
+
 /**
  * Enter an object in the list of objects for the current level/chunk.  This
  * function is robust against listing of duplicates or non-objects
@@ -206,6 +238,7 @@ void list_object(struct chunk *c, struct object *obj)
 		if (c->objects[i] == NULL) {
 			c->objects[i] = obj;
 			obj->oidx = i;
+			list_timed_object(c, obj);
 			return;
 		}
 	}
@@ -226,6 +259,22 @@ void list_object(struct chunk *c, struct object *obj)
 			player->cave->objects[i] = NULL;
 		player->cave->obj_max = c->obj_max;
 	}
+
+	list_timed_object(c, obj);
+}
+
+/**
+ * Find all the objects on a level/chunk which can recharge, for a chunk whose
+ * object list was filled in directly
+ */
+void list_timed_objects(struct chunk *c)
+{
+	int i;
+
+	c->obj_timed_num = 0;
+	for (i = 1; i < c->obj_max; i++)
+		if (c->objects[i])
+			list_timed_object(c, c->objects[i]);
 }
 
 /**
@@ -320,6 +369,25 @@ struct monster *cave_monster(struct chunk *c, int idx) {
 	return &c->monsters[idx];
 }
 
+/**
+ * Get what a monster on the current level knows about the player, by the
+ * monster's index.
+ */
+struct monster_known *cave_monster_known(struct chunk *c, int idx) {
+	if (idx <= 0 || !c->monsters_known) return NULL;
+	return &c->monsters_known[idx];
+}
+
+/**
+ * Get a monster on the current level from a handle, or NULL if the monster
+ * the handle was made for is no longer there.
+ */
+struct monster *cave_monster_handle(struct chunk *c, struct monster_handle h) {
+	struct monster *mon = cave_monster(c, h.idx);
+	if (!mon || !mon->race || mon->gen != h.gen) return NULL;
+	return mon;
+}
+
 /**
  * The maximum number of monsters allowed in the level.
  */
@@ -24,6 +24,8 @@
 
 struct player;
 struct monster;
+struct monster_known;
+struct monster_handle;
 
 extern const s16b ddd[9];
 extern const s16b ddx[10];
@@ -159,13 +161,22 @@ struct chunk {
 
 	struct object **objects;
 	u16b obj_max;
+	u16b *obj_timed;	/* Indexes of listed objects which can recharge */
+	u16b obj_timed_num;
+	u16b obj_timed_max;
 
 	struct monster *monsters;
+	struct monster_known *monsters_known;	/* What each monster knows */
 	u16b mon_max;
 	u16b mon_cnt;
+	u16b *mon_free;		/* Stack of free slots below mon_max */
+	u16b mon_free_num;
 	int mon_current;
 
 	struct trap *trap_current;
+	struct loc *trap_timed;	/* Grids with traps that are timed out */
+	u16b trap_timed_num;
+	u16b trap_timed_max;
 };
 
 /*** Feature Indexes (see "lib/gamedata/terrain.txt") ***/
@@ -372,11 +383,14 @@ void set_terrain(void);
 struct chunk *cave_new(int height, int width);
 void cave_free(struct chunk *c);
 void list_object(struct chunk *c, struct object *obj);
+void list_timed_objects(struct chunk *c);
 void delist_object(struct chunk *c, struct object *obj);
 void object_lists_check_integrity(struct chunk *c, struct chunk *c_k);
 void scatter(struct chunk *c, int *yp, int *xp, int y, int x, int d, bool need_los);
 
 struct monster *cave_monster(struct chunk *c, int idx);
+struct monster_known *cave_monster_known(struct chunk *c, int idx);
+struct monster *cave_monster_handle(struct chunk *c, struct monster_handle h);
 int cave_monster_max(struct chunk *c);
 int cave_monster_count(struct chunk *c);
 
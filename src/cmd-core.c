@@ -154,6 +154,11 @@ struct command *cmdq_peek(void)
 	return &cmd_queue[prev_cmd_idx(cmd_head)];
 }
 
+int cmdq_length(void)
+{
+	return (cmd_head + CMD_QUEUE_SIZE - cmd_tail) % CMD_QUEUE_SIZE;
+}
+
 
 /**
  * Insert the given command into the command queue.
@@ -237,6 +237,11 @@ const char *cmd_verb(cmd_code cmd);
  */
 struct command *cmdq_peek(void);
 
+/**
+ * Returns the number of commands waiting on the queue.
+ */
+int cmdq_length(void);
+
 /**
  * A function called by the game to get a command from the UI.
  */
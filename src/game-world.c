@@ -156,13 +156,35 @@ static void recharged_notice(const struct object *obj, bool all)
 }
 
 
+/**
+ * Recharge rods and other such objects on the level by the given number of
+ * turns; these are kept in a list so the level need not be searched for them
+ */
+static void recharge_level_objects(int turns)
+{
+	int i = 0;
+
+	while (i < cave->obj_timed_num) {
+		struct object *obj = cave->objects[cave->obj_timed[i]];
+
+		/* Forget objects which have left the level */
+		if (!obj || !tval_can_have_timeout(obj)) {
+			cave->obj_timed[i] = cave->obj_timed[--cave->obj_timed_num];
+			continue;
+		}
+
+		/* Recharge rods */
+		recharge_timeout_many(obj, turns);
+		i++;
+	}
+}
+
 /**
  * Recharge activatable objects in the player's equipment
  * and rods in the inventory and on the ground.
  */
 static void recharge_objects(void)
 {
-	int i;
 	bool discharged_stack;
 	struct object *obj;
 
@@ -206,14 +228,7 @@ static void recharge_objects(void)
 	}
 
 	/* Recharge other level objects */
-	for (i = 1; i < cave->obj_max; i++) {
-		obj = cave->objects[i];
-		if (!obj) continue;
-
-		/* Recharge rods */
-		if (tval_can_have_timeout(obj))
-			recharge_timeout(obj);
-	}
+	recharge_level_objects(1);
 }
 
 
@@ -302,21 +317,37 @@ static void decrease_timeouts(void)
 }
 
 
+/**
+ * Helper for process_world -- the amount of food digested every 100 game turns
+ */
+static int player_digestion(void)
+{
+	/* Basic digestion rate based on speed */
+	int i = turn_energy(player->state.speed) * 2;
+
+	/* Regeneration takes more food */
+	if (player_of_has(player, OF_REGEN)) i += 30;
+
+	/* Slow digestion takes less food */
+	if (player_of_has(player, OF_SLOW_DIGEST)) i /= 5;
+
+	/* Minimal digestion */
+	if (i < 1) i = 1;
+
+	return i;
+}
+
 /**
  * Handle things that need updating once every 10 game turns
  */
 void process_world(struct chunk *c)
 {
-	int i, y, x;
+	int i;
 
 	/* Compact the monster list if we're approaching the limit */
 	if (cave_monster_count(cave) + 32 > z_info->level_monster_max)
 		compact_monsters(64);
 
-	/* Too many holes in the monster list - compress */
-	if (cave_monster_count(cave) + 32 < cave_monster_max(cave))
-		compact_monsters(0);
-
 	/*** Check the Time ***/
 
 	/* Play an ambient sound at regular intervals. */
@@ -386,22 +417,8 @@ void process_world(struct chunk *c)
 	/*** Check the Food, and Regenerate ***/
 
 	/* Digest normally */
-	if (!(turn % 100)) {
-		/* Basic digestion rate based on speed */
-		i = turn_energy(player->state.speed) * 2;
-
-		/* Regeneration takes more food */
-		if (player_of_has(player, OF_REGEN)) i += 30;
-
-		/* Slow digestion takes less food */
-		if (player_of_has(player, OF_SLOW_DIGEST)) i /= 5;
-
-		/* Minimal digestion */
-		if (i < 1) i = 1;
-
-		/* Digest some food */
-		player_set_food(player, player->food - i);
-	}
+	if (!(turn % 100))
+		player_set_food(player, player->food - player_digestion());
 
 	/* Getting Faint */
 	if (player->food < PY_FOOD_FAINT) {
@@ -462,19 +479,7 @@ void process_world(struct chunk *c)
 		equip_learn_after_time(player);
 
 	/* Decrease trap timeouts */
-	for (y = 0; y < cave->height; y++) {
-		for (x = 0; x < cave->width; x++) {
-			struct trap *trap = cave->squares[y][x].trap;
-			while (trap) {
-				if (trap->timeout) {
-					trap->timeout--;
-					if (!trap->timeout)
-						square_light_spot(cave, y, x);
-				}
-				trap = trap->next;
-			}
-		}
-	}
+	decrease_trap_timeouts(cave, 1);
 
 
 	/*** Involuntary Movement ***/
@@ -539,6 +544,37 @@ void process_world(struct chunk *c)
 }
 
 
+/**
+ * Helper for process_player_cleanup -- update monsters after the player has
+ * used up some energy
+ */
+static void process_player_monsters(void)
+{
+	int i;
+
+	/* Shimmer multi-hued monsters */
+	for (i = 1; i < cave_monster_max(cave); i++) {
+		struct monster *mon = cave_monster(cave, i);
+		if (!mon->race)
+			continue;
+		if (!rf_has(mon->race->flags, RF_ATTR_MULTI))
+			continue;
+		square_light_spot(cave, mon->fy, mon->fx);
+	}
+
+	/* Clear NICE flag, and show marked monsters */
+	for (i = 1; i < cave_monster_max(cave); i++) {
+		struct monster *mon = cave_monster(cave, i);
+		mflag_off(mon->mflag, MFLAG_NICE);
+		if (mflag_has(mon->mflag, MFLAG_MARK)) {
+			if (!mflag_has(mon->mflag, MFLAG_SHOW)) {
+				mflag_off(mon->mflag, MFLAG_MARK);
+				update_mon(mon, cave, false);
+			}
+		}
+	}
+}
+
 /**
  * Housekeeping after the processing of a player command
  */
@@ -560,27 +596,8 @@ static void process_player_cleanup(void)
 			if (player->timed[TMD_IMAGE])
 				player->upkeep->redraw |= (PR_MAP);
 
-			/* Shimmer multi-hued monsters */
-			for (i = 1; i < cave_monster_max(cave); i++) {
-				struct monster *mon = cave_monster(cave, i);
-				if (!mon->race)
-					continue;
-				if (!rf_has(mon->race->flags, RF_ATTR_MULTI))
-					continue;
-				square_light_spot(cave, mon->fy, mon->fx);
-			}
-
-			/* Clear NICE flag, and show marked monsters */
-			for (i = 1; i < cave_monster_max(cave); i++) {
-				struct monster *mon = cave_monster(cave, i);
-				mflag_off(mon->mflag, MFLAG_NICE);
-				if (mflag_has(mon->mflag, MFLAG_MARK)) {
-					if (!mflag_has(mon->mflag, MFLAG_SHOW)) {
-						mflag_off(mon->mflag, MFLAG_MARK);
-						update_mon(mon, cave, false);
-					}
-				}
-			}
+			/* Shimmer and unmark monsters */
+			process_player_monsters();
 		}
 	}
 
@@ -597,6 +614,25 @@ static void process_player_cleanup(void)
 }
 
 
+/**
+ * Helper for process_player -- dwarves detect treasure at the start of each
+ * turn, if they are in good shape
+ */
+static void process_player_see_ore(void)
+{
+	if (!player_has(player, PF_SEE_ORE))
+		return;
+
+	if (!player->timed[TMD_IMAGE] &&
+		!player->timed[TMD_CONFUSED] &&
+		!player->timed[TMD_AMNESIA] &&
+		!player->timed[TMD_STUN] &&
+		!player->timed[TMD_PARALYZED] &&
+		!player->timed[TMD_TERROR] &&
+		!player->timed[TMD_AFRAID])
+		effect_simple(EF_DETECT_GOLD, "3d3", 1, 0, 0, NULL);
+}
+
 /**
  * Process player commands from the command queue, finishing when there is a
  * command using energy (any regular game command), or we run out of commands
@@ -633,17 +669,7 @@ void process_player(void)
 		player->upkeep->energy_use = 0;
 
 		/* Dwarves detect treasure */
-		if (player_has(player, PF_SEE_ORE)) {
-			/* Only if they are in good shape */
-			if (!player->timed[TMD_IMAGE] &&
-				!player->timed[TMD_CONFUSED] &&
-				!player->timed[TMD_AMNESIA] &&
-				!player->timed[TMD_STUN] &&
-				!player->timed[TMD_PARALYZED] &&
-				!player->timed[TMD_TERROR] &&
-				!player->timed[TMD_AFRAID])
-				effect_simple(EF_DETECT_GOLD, "3d3", 1, 0, 0, NULL);
-		}
+		process_player_see_ore();
 
 		/* Paralyzed or Knocked Out player gets no turn */
 		if ((player->timed[TMD_PARALYZED]) || (player->timed[TMD_STUN] >= 100))
@@ -685,6 +711,10 @@ void on_new_level(void)
 	/* Play ambient sound on change of level. */
 	play_ambient_sound();
 
+	/* Find the things on the level which count down each turn */
+	list_timed_objects(cave);
+	list_timed_traps(cave);
+
 	/* Cancel the target */
 	target_set_monster(0);
 
@@ -743,6 +773,298 @@ static void on_leave_level(void) {
 }
 
 
+/**
+ * Skip over game turns in which nothing can happen.
+ *
+ * Called at the start of a game turn which follows one where the player did
+ * not move, so all monsters are ready to act and the player's state is up to
+ * date.
+ * Work out how many turns will pass before the player or a monster has
+ * enough energy to move, or process_world() is next due.  Those turns only
+ * hand out energy and draw nothing from the RNG, so they can be applied in
+ * one step.
+ */
+static void process_quiet_turns(void)
+{
+	int player_gain = turn_energy(player->state.speed);
+	int turns = (10 - turn % 10) % 10;
+
+	/* The player must not reach move energy during the skipped turns */
+	if (player_gain > 0) {
+		int player_turns = (z_info->move_energy - 1 - player->energy) /
+			player_gain;
+		if (player_turns < turns)
+			turns = player_turns;
+	}
+
+	/* Nor can any monster get to move */
+	turns = monsters_turns_until_move(cave, turns);
+	if (turns <= 0) return;
+
+	/* Hand out the energy in bulk */
+	monsters_gain_energy(cave, turns);
+	player->energy += turns * player_gain;
+	turn += turns;
+}
+
+/**
+ * Helper for process_rest_turns -- count how many times process_world() can
+ * run before any of the player's timeouts, recharging gear or light would do
+ * something noticeable, or their hit points or mana would be full
+ */
+static int rest_ticks_max(void)
+{
+	int ticks = z_info->day_length;
+	int i, j, regen = player_regen_turns(player);
+	struct object *obj;
+
+	/* Timed effects must not run out */
+	for (i = 0; i < TMD_MAX; i++)
+		if (player->timed[i])
+			ticks = MIN(ticks, player->timed[i] - 1);
+
+	/* Nor can curses take effect */
+	for (i = 0; i < player->body.count; i++) {
+		obj = player->body.slots[i].obj;
+		if (!obj || !obj->curses) continue;
+		for (j = 0; j < z_info->curse_max; j++)
+			if (obj->curses[j].power)
+				ticks = MIN(ticks, obj->curses[j].timeout - 1);
+	}
+
+	/* Light must stay bright enough not to warrant a warning */
+	obj = player_light_burning(player);
+	if (obj)
+		ticks = MIN(ticks, obj->timeout - 50);
+
+	/* Recharging gear must not get a charge back */
+	for (obj = player->gear; obj; obj = obj->next) {
+		int turns;
+
+		if (!object_is_equipped(player->body, obj) &&
+			!tval_can_have_timeout(obj))
+			continue;
+
+		turns = recharge_timeout_turns(obj);
+		if (turns)
+			ticks = MIN(ticks, turns - 1);
+	}
+
+	/* No recall or descent */
+	if (player->word_recall)
+		ticks = MIN(ticks, player->word_recall - 1);
+	if (player->deep_descent)
+		ticks = MIN(ticks, player->deep_descent - 1);
+
+	/* Hit points and mana must not fill up */
+	if (regen >= 0)
+		ticks = MIN(ticks, regen - 1);
+
+	return ticks;
+}
+
+/**
+ * Helper for process_rest_turns -- do the work of a number of calls to
+ * process_world() at once, for a player who is resting quietly and not
+ * reaching any limit found by rest_ticks_max()
+ */
+static void process_rest_ticks(int ticks)
+{
+	int i, j;
+	struct object *obj;
+
+	/* Regenerate */
+	player_regen_many(player, ticks);
+
+	/* Timeout various things */
+	for (i = 0; i < TMD_MAX; i++)
+		if (player->timed[i])
+			player_dec_timed(player, i, ticks, false);
+
+	for (i = 0; i < player->body.count; i++) {
+		obj = player->body.slots[i].obj;
+		if (!obj || !obj->curses) continue;
+		for (j = 0; j < z_info->curse_max; j++)
+			if (obj->curses[j].power)
+				obj->curses[j].timeout -= ticks;
+	}
+
+	/* Burn fuel */
+	obj = player_light_burning(player);
+	if (obj) {
+		obj->timeout -= ticks;
+		player->upkeep->redraw |= (PR_EQUIP);
+	}
+	player->upkeep->update |= (PU_TORCH);
+
+	/* Recharge activatable objects and rods */
+	for (obj = player->gear; obj; obj = obj->next)
+		if (object_is_equipped(player->body, obj) ||
+			tval_can_have_timeout(obj))
+			recharge_timeout_many(obj, ticks);
+
+	recharge_level_objects(ticks);
+
+	/* Decrease trap timeouts */
+	decrease_trap_timeouts(cave, ticks);
+
+	/* Count down towards recall */
+	if (player->word_recall)
+		player->word_recall -= ticks;
+	if (player->deep_descent)
+		player->deep_descent -= ticks;
+}
+
+/**
+ * Get through a stretch of resting in one go.
+ *
+ * Called right after the turn count goes up, when every monster is ready to
+ * act again.  If the player is resting, no monster is awake or can notice
+ * them, and nothing is about to hurt them, the only things that can happen
+ * for a while are known in advance: regeneration, timeouts, recharging,
+ * digestion and the passing of monsters' turns.  So step through the game
+ * turns looking only for what would end the quiet - a new monster, a
+ * message, a rest finishing, or a chance to check for a keypress - while
+ * making the same random draws the game would, then apply all the turns up to
+ * that point in bulk and hand back to the game loop.
+ */
+static void process_rest_turns(void)
+{
+	struct command *cmd = cmdq_peek();
+	int gain = turn_energy(player->state.speed);
+	int energy = player->energy;
+	int turns = 0, ticks = 0, digests = 0, days = 0, rests = 0;
+	int ticks_max, digest, digests_max, food_min;
+	rand_state rng;
+
+	/* The player must be resting, with nothing else to do */
+	if (!player_is_resting(player) || cmdq_length() != 1 ||
+		cmd->code != CMD_REST || cmd_get_nrepeats() > 0)
+		return;
+	if (!player_resting_can_regenerate(player) ||
+		player_resting_is_complete(player))
+		return;
+
+	/* Or to worry about */
+	if (player->is_dead || !player->upkeep->playing ||
+		player->upkeep->generate_level)
+		return;
+	if (player->timed[TMD_POISONED] || player->timed[TMD_CUT] ||
+		player->timed[TMD_STUN] || player->timed[TMD_PARALYZED] ||
+		player->timed[TMD_IMAGE])
+		return;
+	if (player->food < PY_FOOD_WEAK || player_of_has(player, OF_DRAIN_EXP))
+		return;
+
+	/* The monster list must not need compacting */
+	if (cave_monster_count(cave) + 32 > z_info->level_monster_max)
+		return;
+
+	/* Nobody must come looking */
+	if (!monsters_are_dormant(cave))
+		return;
+
+	/* Digest without going hungrier */
+	digest = player_digestion();
+	if (player->food < PY_FOOD_ALERT)
+		food_min = PY_FOOD_WEAK;
+	else if (player->food < PY_FOOD_FULL)
+		food_min = PY_FOOD_ALERT;
+	else
+		food_min = PY_FOOD_FULL;
+	digests_max = (player->food - food_min) / digest;
+
+	ticks_max = rest_ticks_max();
+
+	/* Find how many game turns can be skipped */
+	Rand_state_save(&rng);
+	while (true) {
+		s32b t = turn + turns;
+		int e = energy, acts = 0;
+		bool stop = false;
+
+		/* The player rests first */
+		while (e >= z_info->move_energy) {
+			/* Leave the keypress check, and the end of a rest, to the game */
+			if (!(t & 0x7F) || (player->upkeep->resting > 0 &&
+								rests + acts + 2 > player->upkeep->resting)) {
+				stop = true;
+				break;
+			}
+
+			process_player_see_ore();
+			e -= z_info->move_energy;
+			acts++;
+		}
+
+		/* Day and night */
+		if (turns && !(t % ((10L * z_info->day_length) / 2)))
+			stop = true;
+
+		/* Then the world */
+		if (!stop && !(t % 10)) {
+			if (!(t % ((10L * z_info->day_length) / 4)) ||
+				ticks >= ticks_max ||
+				(!(t % 100) && digests >= digests_max) ||
+				one_in_(z_info->alloc_monster_chance))
+				stop = true;
+		}
+
+		if (stop) break;
+
+		/* This turn passes quietly */
+		if (!(t % 10)) {
+			ticks++;
+			if (!(t % 100))
+				digests++;
+			if (player->depth && !(t % (10L * z_info->store_turns)))
+				days++;
+		}
+		rests += acts;
+		energy = e + gain;
+		turns++;
+		Rand_state_save(&rng);
+	}
+
+	/* Undo the random draws of the turn which was not skipped */
+	Rand_state_restore(&rng);
+	if (!turns) return;
+
+	/* Monsters sleep or wander out of sight */
+	monsters_pass_turns(cave, turns);
+	player->upkeep->update |= PU_MONSTERS;
+
+	/* The world goes on */
+	process_rest_ticks(ticks);
+	while (digests--) {
+		player_set_food(player, player->food - digest);
+		equip_learn_after_time(player);
+	}
+	daycount += days;
+
+	/* The player rests */
+	if (rests) {
+		int i;
+
+		player->upkeep->energy_use = z_info->move_energy;
+		player->total_energy += rests * z_info->move_energy;
+		player_resting_step_turns(player, rests);
+		if (player->upkeep->resting > 0)
+			cmd_set_arg_choice(cmd, "choice", player->upkeep->resting);
+		else
+			player_set_resting_repeat_count(player, 0);
+
+		process_player_monsters();
+		for (i = 1; i < cave_monster_max(cave); i++) {
+			struct monster *mon = cave_monster(cave, i);
+			mflag_off(mon->mflag, MFLAG_SHOW);
+		}
+	}
+	player->energy = energy;
+
+	turn += turns;
+}
+
 /**
  * The main game loop.
  *
@@ -751,6 +1073,9 @@ static void on_leave_level(void) {
  */
 void run_game_loop(void)
 {
+	/* Whether the next game turn starts with every monster unhandled */
+	bool quiet = false;
+
 	/* Tidy up after the player's command */
 	process_player_cleanup();
 
@@ -799,6 +1124,10 @@ void run_game_loop(void)
 		if (player->is_dead || !player->upkeep->playing)
 			return;
 		else if (!player->upkeep->generate_level) {
+			/* Skip over game turns in which nothing can happen */
+			if (quiet)
+				process_quiet_turns();
+
 			/* Process the rest of the monsters */
 			process_monsters(cave, 0);
 
@@ -829,6 +1158,12 @@ void run_game_loop(void)
 
 			/* Count game turns */
 			turn++;
+
+			/* All monsters are ready to act again */
+			quiet = true;
+
+			/* Rest quickly while nothing is happening */
+			process_rest_turns();
 		}
 
 		/* Make a new level if requested */
@@ -840,11 +1175,14 @@ void run_game_loop(void)
 			on_new_level();
 
 			player->upkeep->generate_level = false;
+			quiet = false;
 		}
 
 		/* If the player has enough energy to move they now do so, after
 		 * any monsters with more energy take their turns */
 		while (player->energy >= z_info->move_energy) {
+			quiet = false;
+
 			/* Do any necessary animations */
 			event_signal(EVENT_ANIMATE);
 
@@ -91,6 +91,9 @@ struct chunk *chunk_write(int y0, int x0, int height, int width, bool monsters,
 					new->squares[y][x].mon = ++new->mon_cnt;
 					dest_mon = cave_monster(new, new->mon_cnt);
 					memcpy(dest_mon, source_mon, sizeof(*source_mon));
+					memcpy(cave_monster_known(new, new->mon_cnt),
+						   cave_monster_known(cave, source_mon->midx),
+						   sizeof(struct monster_known));
 
 					/* Adjust position */
 					dest_mon->fy = y;
@@ -311,6 +314,9 @@ bool chunk_copy(struct chunk *dest, struct chunk *source, int y0, int x0,
 				dest_mon = cave_monster(dest, idx);
 				dest->squares[dest_y][dest_x].mon = idx;
 				memcpy(dest_mon, source_mon, sizeof(*source_mon));
+				memcpy(cave_monster_known(dest, idx),
+					   cave_monster_known(source, source_mon->midx),
+					   sizeof(struct monster_known));
 
 				/* Adjust stuff */
 				dest_mon->midx = idx;
@@ -202,7 +202,7 @@ void spread_monsters(struct chunk *c, const char *type, int depth, int num,
     int i, j;			/* Limits on loops */
     int count;
     int y = y0, x = x0;
-    int start_mon_num = c->mon_max;
+    int start_mon_num = c->mon_cnt;
 
     /* Restrict monsters.  Allow uniques. Leave area empty if none found. */
     if (!mon_restrict(type, depth, true))
@@ -246,7 +246,7 @@ void spread_monsters(struct chunk *c, const char *type, int depth, int num,
 		pick_and_place_monster(c, y, x, depth, true, true, origin);
 
 		/* Rein in monster groups and escorts a little. */
-		if (c->mon_max - start_mon_num > num * 2)
+		if (c->mon_cnt - start_mon_num > num * 2)
 			break;
 
 		/* Count the monster(s), reset the loop count */
@@ -911,19 +911,15 @@ static bool find_space(int *y, int *x, int height, int width)
  * \param c the chunk the room is being built in
  * \param y0 co-ordinates of the centre; out of chunk bounds invoke find_space()
  * \param x0 co-ordinates of the centre; out of chunk bounds invoke find_space()
- * \param ymax the room dimensions
- * \param xmax the room dimensions
- * \param doors the door position
- * \param data the room template text description
- * \param tval the object type for any included objects
+ * \param room the room template
  * \return success
  */
-static bool build_room_template(struct chunk *c, int y0, int x0, int ymax, int xmax, int doors, const char *data, int tval)
+static bool build_room_template(struct chunk *c, int y0, int x0,
+								struct room_template *room)
 {
-	int dx, dy, x, y, rnddoors, doorpos;
-	const char *t;
+	int ymax = room->hgt, xmax = room->wid;
+	int i, x, y, rnddoors, doorpos;
 	bool rndwalls, light;
-	
 
 	assert(c);
 
@@ -932,7 +928,7 @@ static bool build_room_template(struct chunk *c, int y0, int x0, int ymax, int x
 
 	/* Set the random door position here so it generates doors in all squares
 	 * marked with the same number */
-	rnddoors = randint1(doors);
+	rnddoors = randint1(room->dor);
 
 	/* Decide whether optional walls will be generated this time */
 	rndwalls = one_in_(2) ? true : false;
@@ -944,111 +940,109 @@ static bool build_room_template(struct chunk *c, int y0, int x0, int ymax, int x
 	}
 
 	/* Place dungeon features and objects */
-	for (t = data, dy = 0; dy < ymax && *t; dy++) {
-		for (dx = 0; dx < xmax && *t; dx++, t++) {
-			/* Extract the location */
-			x = x0 - (xmax / 2) + dx;
-			y = y0 - (ymax / 2) + dy;
-
-			/* Skip non-grids */
-			if (*t == ' ') continue;
-
-			/* Lay down a floor */
-			square_set_feat(c, y, x, FEAT_FLOOR);
-
-			/* Debugging assertion */
-			assert(square_isempty(c, y, x));
-
-			/* Analyze the grid */
-			switch (*t) {
-			case '%': set_marked_granite(c, y, x, SQUARE_WALL_OUTER); break;
-			case '#': set_marked_granite(c, y, x, SQUARE_WALL_SOLID); break;
-			case '+': place_closed_door(c, y, x); break;
-			case '^': place_trap(c, y, x, -1, c->depth); break;
-			case 'x': {
-
-				/* If optional walls are generated, put a wall in this square */
-				if (rndwalls)
-					set_marked_granite(c, y, x, SQUARE_WALL_SOLID);
-				break;
-			}
-			case '(': {
-
-				/* If optional walls are generated, put a door in this square */
-				if (rndwalls)
-					place_secret_door(c, y, x);
-				break;
-			}
-			case ')': {
-				/* If no optional walls generated, put a door in this square */
-				if (!rndwalls)
-					place_secret_door(c, y, x);
-				else
-					set_marked_granite(c, y, x, SQUARE_WALL_SOLID);
-				break;
-			}
-			case '8': {
+	for (i = 0; i < room->num_cells; i++) {
+		const char *t = room->text + room->cells[i];
+
+		/* Extract the location */
+		x = x0 - (xmax / 2) + room->cells[i] % xmax;
+		y = y0 - (ymax / 2) + room->cells[i] / xmax;
+
+		/* Lay down a floor */
+		square_set_feat(c, y, x, FEAT_FLOOR);
+
+		/* Debugging assertion */
+		assert(square_isempty(c, y, x));
+
+		/* Analyze the grid */
+		switch (*t) {
+		case '%': set_marked_granite(c, y, x, SQUARE_WALL_OUTER); break;
+		case '#': set_marked_granite(c, y, x, SQUARE_WALL_SOLID); break;
+		case '+': place_closed_door(c, y, x); break;
+		case '^': place_trap(c, y, x, -1, c->depth); break;
+		case 'x': {
+
+			/* If optional walls are generated, put a wall in this square */
+			if (rndwalls)
+				set_marked_granite(c, y, x, SQUARE_WALL_SOLID);
+			break;
+		}
+		case '(': {
 
-				/* Put something nice in this square
-				 * Object (80%) or Stairs (20%) */
-				if (randint0(100) < 80)
-					place_object(c, y, x, c->depth, false, false, ORIGIN_SPECIAL, 0);
-				else
-					place_random_stairs(c, y, x);
+			/* If optional walls are generated, put a door in this square */
+			if (rndwalls)
+				place_secret_door(c, y, x);
+			break;
+		}
+		case ')': {
+			/* If no optional walls generated, put a door in this square */
+			if (!rndwalls)
+				place_secret_door(c, y, x);
+			else
+				set_marked_granite(c, y, x, SQUARE_WALL_SOLID);
+			break;
+		}
+		case '8': {
 
-				/* Some monsters to guard it */
-				vault_monsters(c, y, x, c->depth + 2, randint0(2) + 3);
+			/* Put something nice in this square
+			 * Object (80%) or Stairs (20%) */
+			if (randint0(100) < 80)
+				place_object(c, y, x, c->depth, false, false, ORIGIN_SPECIAL, 0);
+			else
+				place_random_stairs(c, y, x);
 
-				break;
-			}
-			case '9': {
+			/* Some monsters to guard it */
+			vault_monsters(c, y, x, c->depth + 2, randint0(2) + 3);
 
-				/* Create some interesting stuff nearby */
+			break;
+		}
+		case '9': {
 
-				/* A few monsters */
-				vault_monsters(c, y - 3, x - 3, c->depth + randint0(2), randint1(2));
-				vault_monsters(c, y + 3, x + 3, c->depth + randint0(2), randint1(2));
+			/* Create some interesting stuff nearby */
 
-				/* And maybe a bit of treasure */
+			/* A few monsters */
+			vault_monsters(c, y - 3, x - 3, c->depth + randint0(2), randint1(2));
+			vault_monsters(c, y + 3, x + 3, c->depth + randint0(2), randint1(2));
 
-				if (one_in_(2))
-					vault_objects(c, y - 2, x + 2, c->depth, 1 + randint0(2));
+			/* And maybe a bit of treasure */
 
-				if (one_in_(2))
-					vault_objects(c, y + 2, x - 2, c->depth, 1 + randint0(2));
+			if (one_in_(2))
+				vault_objects(c, y - 2, x + 2, c->depth, 1 + randint0(2));
 
-				break;
+			if (one_in_(2))
+				vault_objects(c, y + 2, x - 2, c->depth, 1 + randint0(2));
 
-			}
-			case '[': {
-				
-				/* Place an object of the template's specified tval */
-				place_object(c, y, x, c->depth, false, false, ORIGIN_SPECIAL, tval);
-				break;
-			}
-			case '1':
-			case '2':
-			case '3':
-			case '4':
-			case '5':
-			case '6': {
-				/* Check if this is chosen random door position */
-				doorpos = (int) (*t - '0');
-
-				if (doorpos == rnddoors)
-					place_secret_door(c, y, x);
-				else
-					set_marked_granite(c, y, x, SQUARE_WALL_SOLID);
+			break;
 
-				break;
-			}
-			}
+		}
+		case '[': {
+			
+			/* Place an object of the template's specified tval */
+			place_object(c, y, x, c->depth, false, false, ORIGIN_SPECIAL,
+						 room->tval);
+			break;
+		}
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6': {
+			/* Check if this is chosen random door position */
+			doorpos = (int) (*t - '0');
+
+			if (doorpos == rnddoors)
+				place_secret_door(c, y, x);
+			else
+				set_marked_granite(c, y, x, SQUARE_WALL_SOLID);
 
-			/* Part of a room */
-			sqinfo_on(c->squares[y][x].info, SQUARE_ROOM);
-			if (light)
-				sqinfo_on(c->squares[y][x].info, SQUARE_GLOW);
+			break;
+		}
 		}
+
+		/* Part of a room */
+		sqinfo_on(c->squares[y][x].info, SQUARE_ROOM);
+		if (light)
+			sqinfo_on(c->squares[y][x].info, SQUARE_GLOW);
 	}
 
 	return true;
@@ -1071,8 +1065,7 @@ static bool build_room_template_type(struct chunk *c, int y0, int x0, int typ,
 		return false;
 
 	/* Build the room */
-	if (!build_room_template(c, y0, x0, room->hgt, room->wid, room->dor,
-							 room->text, room->tval))
+	if (!build_room_template(c, y0, x0, room))
 		return false;
 
 	ROOM_LOG("Room template (%s)", room->name);
@@ -1092,9 +1085,8 @@ bool build_vault(struct chunk *c, int y0, int x0, struct vault *v)
 {
 	const char *data = v->text;
 	int y1, x1, y2, x2;
-	int x, y, races_local = 0;
+	int x, y, i;
 	const char *t;
-	char racial_symbol[30] = "";
 	bool icky;
 
 	assert(c);
@@ -1193,140 +1185,126 @@ bool build_vault(struct chunk *c, int y0, int x0, struct vault *v)
 
 
 	/* Place regular dungeon monsters and objects */
-	for (t = data, y = y1; y <= y2 && *t; y++) {
-		for (x = x1; x <= x2 && *t; x++, t++) {
-			/* Hack -- skip "non-grids" */
-			if (*t == ' ') continue;
-
-			/* Most alphabetic characters signify monster races. */
-			if (isalpha(*t) && (*t != 'x') && (*t != 'X')) {
-				/* If the symbol is not yet stored, ... */
-				if (!strchr(racial_symbol, *t)) {
-					/* ... store it for later processing. */
-					if (races_local < 30)
-						racial_symbol[races_local++] = *t;
-				}
-			}
-
-			/* Otherwise, analyze the symbol */
+	for (i = 0; i < v->num_marks; i++) {
+		y = y1 + v->marks[i] / v->wid;
+		x = x1 + v->marks[i] % v->wid;
+
+		switch (data[v->marks[i]]) {
+			/* An ordinary monster, object (sometimes good), or trap. */
+		case '1': {
+			if (one_in_(2))
+				pick_and_place_monster(c, y, x, c->depth , true, true,
+									   ORIGIN_DROP_VAULT);
+			else if (one_in_(2))
+				place_object(c, y, x, c->depth, one_in_(8) ? true : false, false, ORIGIN_VAULT, 0);
 			else
-				switch (*t) {
-					/* An ordinary monster, object (sometimes good), or trap. */
-				case '1': {
-					if (one_in_(2))
-						pick_and_place_monster(c, y, x, c->depth , true, true,
-											   ORIGIN_DROP_VAULT);
-					else if (one_in_(2))
-						place_object(c, y, x, c->depth, one_in_(8) ? true : false, false, ORIGIN_VAULT, 0);
-					else
-						place_trap(c, y, x, -1, c->depth);
-					break;
-				}
-					/* Slightly out of depth monster. */
-				case '2': pick_and_place_monster(c, y, x, c->depth + 5, true, true, ORIGIN_DROP_VAULT); break;
-					/* Slightly out of depth object. */
-				case '3': place_object(c, y, x, c->depth + 3, false, false, 
-									   ORIGIN_VAULT, 0); break;
-					/* Monster and/or object */
-				case '4': {
-					if (one_in_(2))
-						pick_and_place_monster(c, y, x, c->depth + 3, true, 
-											   true, ORIGIN_DROP_VAULT);
-					if (one_in_(2))
-						place_object(c, y, x, c->depth + 7, false, false,
-									 ORIGIN_VAULT, 0);
-					break;
-				}
-					/* Out of depth object. */
-				case '5': place_object(c, y, x, c->depth + 7, false, false,
-									   ORIGIN_VAULT, 0); break;
-					/* Out of depth monster. */
-				case '6': pick_and_place_monster(c, y, x, c->depth + 11, true, true, ORIGIN_DROP_VAULT); break;
-					/* Very out of depth object. */
-				case '7': place_object(c, y, x, c->depth + 15, false, false,
-									   ORIGIN_VAULT, 0); break;
-					/* Very out of depth monster. */
-				case '0': pick_and_place_monster(c, y, x, c->depth + 20, true, true, ORIGIN_DROP_VAULT); break;
-					/* Meaner monster, plus treasure */
-				case '9': {
-					pick_and_place_monster(c, y, x, c->depth + 9, true, true,
-										   ORIGIN_DROP_VAULT);
-					place_object(c, y, x, c->depth + 7, true, false,
-								 ORIGIN_VAULT, 0);
-					break;
-				}
-					/* Nasty monster and treasure */
-				case '8': {
-					pick_and_place_monster(c, y, x, c->depth + 40, true, true,
-										   ORIGIN_DROP_VAULT);
-					place_object(c, y, x, c->depth + 20, true, true,
-								 ORIGIN_VAULT, 0);
-					break;
-				}
-					/* A chest. */
-				case '~': place_object(c, y, x, c->depth + 5, true, true,
-									   ORIGIN_VAULT, TV_CHEST); break;
-					/* Treasure. */
-				case '$': place_gold(c, y, x, c->depth, ORIGIN_VAULT);break;
-					/* Armour. */
-				case ']': {
-					int	tval = 0, temp = one_in_(3) ? randint1(9) : randint1(8);
-					switch (temp) {
-					case 1: tval = TV_BOOTS; break;
-					case 2: tval = TV_GLOVES; break;
-					case 3: tval = TV_HELM; break;
-					case 4: tval = TV_CROWN; break;
-					case 5: tval = TV_SHIELD; break;
-					case 6: tval = TV_CLOAK; break;
-					case 7: tval = TV_SOFT_ARMOR; break;
-					case 8: tval = TV_HARD_ARMOR; break;
-					case 9: tval = TV_DRAG_ARMOR; break;
-					}
-					place_object(c, y, x, c->depth + 3, true, false,
-								 ORIGIN_VAULT, tval);
-					break;
-				}
-					/* Weapon. */
-				case '|': {
-					int	tval = 0, temp = randint1(4);
-					switch (temp) {
-					case 1: tval = TV_SWORD; break;
-					case 2: tval = TV_POLEARM; break;
-					case 3: tval = TV_HAFTED; break;
-					case 4: tval = TV_BOW; break;
-					}
-					place_object(c, y, x, c->depth + 3, true, false,
-								 ORIGIN_VAULT, tval);
-					break;
-				}
-					/* Ring. */
-				case '=': place_object(c, y, x, c->depth + 3, one_in_(4), false,
-									   ORIGIN_VAULT, TV_RING); break;
-					/* Amulet. */
-				case '"': place_object(c, y, x, c->depth + 3, one_in_(4), false,
-									   ORIGIN_VAULT, TV_AMULET); break;
-					/* Potion. */
-				case '!': place_object(c, y, x, c->depth + 3, one_in_(4), false,
-									   ORIGIN_VAULT, TV_POTION); break;
-					/* Scroll. */
-				case '?': place_object(c, y, x, c->depth + 3, one_in_(4), false,
-									   ORIGIN_VAULT, TV_SCROLL); break;
-					/* Staff. */
-				case '_': place_object(c, y, x, c->depth + 3, one_in_(4), false,
-									   ORIGIN_VAULT, TV_STAFF); break;
-					/* Wand or rod. */
-				case '-': place_object(c, y, x, c->depth + 3, one_in_(4), false,
-									   ORIGIN_VAULT, one_in_(2) ? TV_WAND : TV_ROD);
-					break;
-					/* Food or mushroom. */
-				case ',': place_object(c, y, x, c->depth + 3, one_in_(4), false,
-									   ORIGIN_VAULT, TV_FOOD); break;
-				}
+				place_trap(c, y, x, -1, c->depth);
+			break;
+		}
+			/* Slightly out of depth monster. */
+		case '2': pick_and_place_monster(c, y, x, c->depth + 5, true, true, ORIGIN_DROP_VAULT); break;
+			/* Slightly out of depth object. */
+		case '3': place_object(c, y, x, c->depth + 3, false, false, 
+							   ORIGIN_VAULT, 0); break;
+			/* Monster and/or object */
+		case '4': {
+			if (one_in_(2))
+				pick_and_place_monster(c, y, x, c->depth + 3, true, 
+									   true, ORIGIN_DROP_VAULT);
+			if (one_in_(2))
+				place_object(c, y, x, c->depth + 7, false, false,
+							 ORIGIN_VAULT, 0);
+			break;
+		}
+			/* Out of depth object. */
+		case '5': place_object(c, y, x, c->depth + 7, false, false,
+							   ORIGIN_VAULT, 0); break;
+			/* Out of depth monster. */
+		case '6': pick_and_place_monster(c, y, x, c->depth + 11, true, true, ORIGIN_DROP_VAULT); break;
+			/* Very out of depth object. */
+		case '7': place_object(c, y, x, c->depth + 15, false, false,
+							   ORIGIN_VAULT, 0); break;
+			/* Very out of depth monster. */
+		case '0': pick_and_place_monster(c, y, x, c->depth + 20, true, true, ORIGIN_DROP_VAULT); break;
+			/* Meaner monster, plus treasure */
+		case '9': {
+			pick_and_place_monster(c, y, x, c->depth + 9, true, true,
+								   ORIGIN_DROP_VAULT);
+			place_object(c, y, x, c->depth + 7, true, false,
+						 ORIGIN_VAULT, 0);
+			break;
+		}
+			/* Nasty monster and treasure */
+		case '8': {
+			pick_and_place_monster(c, y, x, c->depth + 40, true, true,
+								   ORIGIN_DROP_VAULT);
+			place_object(c, y, x, c->depth + 20, true, true,
+						 ORIGIN_VAULT, 0);
+			break;
+		}
+			/* A chest. */
+		case '~': place_object(c, y, x, c->depth + 5, true, true,
+							   ORIGIN_VAULT, TV_CHEST); break;
+			/* Treasure. */
+		case '$': place_gold(c, y, x, c->depth, ORIGIN_VAULT);break;
+			/* Armour. */
+		case ']': {
+			int	tval = 0, temp = one_in_(3) ? randint1(9) : randint1(8);
+			switch (temp) {
+			case 1: tval = TV_BOOTS; break;
+			case 2: tval = TV_GLOVES; break;
+			case 3: tval = TV_HELM; break;
+			case 4: tval = TV_CROWN; break;
+			case 5: tval = TV_SHIELD; break;
+			case 6: tval = TV_CLOAK; break;
+			case 7: tval = TV_SOFT_ARMOR; break;
+			case 8: tval = TV_HARD_ARMOR; break;
+			case 9: tval = TV_DRAG_ARMOR; break;
+			}
+			place_object(c, y, x, c->depth + 3, true, false,
+						 ORIGIN_VAULT, tval);
+			break;
+		}
+			/* Weapon. */
+		case '|': {
+			int	tval = 0, temp = randint1(4);
+			switch (temp) {
+			case 1: tval = TV_SWORD; break;
+			case 2: tval = TV_POLEARM; break;
+			case 3: tval = TV_HAFTED; break;
+			case 4: tval = TV_BOW; break;
+			}
+			place_object(c, y, x, c->depth + 3, true, false,
+						 ORIGIN_VAULT, tval);
+			break;
+		}
+			/* Ring. */
+		case '=': place_object(c, y, x, c->depth + 3, one_in_(4), false,
+							   ORIGIN_VAULT, TV_RING); break;
+			/* Amulet. */
+		case '"': place_object(c, y, x, c->depth + 3, one_in_(4), false,
+							   ORIGIN_VAULT, TV_AMULET); break;
+			/* Potion. */
+		case '!': place_object(c, y, x, c->depth + 3, one_in_(4), false,
+							   ORIGIN_VAULT, TV_POTION); break;
+			/* Scroll. */
+		case '?': place_object(c, y, x, c->depth + 3, one_in_(4), false,
+							   ORIGIN_VAULT, TV_SCROLL); break;
+			/* Staff. */
+		case '_': place_object(c, y, x, c->depth + 3, one_in_(4), false,
+							   ORIGIN_VAULT, TV_STAFF); break;
+			/* Wand or rod. */
+		case '-': place_object(c, y, x, c->depth + 3, one_in_(4), false,
+							   ORIGIN_VAULT, one_in_(2) ? TV_WAND : TV_ROD);
+			break;
+			/* Food or mushroom. */
+		case ',': place_object(c, y, x, c->depth + 3, one_in_(4), false,
+							   ORIGIN_VAULT, TV_FOOD); break;
 		}
 	}
 
 	/* Place specified monsters */
-	get_vault_monsters(c, racial_symbol, v->typ, data, y1, y2, x1, x2);
+	get_vault_monsters(c, v->races, v->typ, data, y1, y2, x1, x2);
 
 	return true;
 }
@@ -147,6 +147,12 @@ void shuffle(int *arr, int n)
 }
 
 
+/**
+ * Number of squares _find_in_range() tests before it sets up a full shuffle
+ * of the range; most searches are done well before this.
+ */
+#define FIND_LAZY_TRIES	32
+
 /**
  * Locate a square in y1 <= y < y2, x1 <= x < x2 which satisfies the given
  * predicate.
@@ -159,6 +165,11 @@ void shuffle(int *arr, int n)
  * \param x2 x-range
  * \param pred square_predicate specifying what we're looking for
  * \return success
+ *
+ * The squares are tested in the order of a random shuffle of the range, but
+ * for the first few tries the shuffle is only tracked by the entries it has
+ * moved, so that a search of a whole level which succeeds quickly does not
+ * have to set up an array the size of the level.
  */
 static bool _find_in_range(struct chunk *c, int *y, int y1, int y2, int *x,
 						   int x1, int x2, square_predicate pred)
@@ -167,17 +178,46 @@ static bool _find_in_range(struct chunk *c, int *y, int y1, int y2, int *x,
     int xd = x2 - x1;
     int i, n = yd * xd;
     bool found = false;
-
-    /* Allocate the squares, and randomize their order */
-    int *squares = mem_alloc(n * sizeof(int));
-    for (i = 0; i < n; i++) squares[i] = i;
+    int *squares = NULL;
+    int moved_pos[FIND_LAZY_TRIES], moved_val[FIND_LAZY_TRIES];
+    int num_moved = 0;
 
     /* Test each square in (random) order for openness */
     for (i = 0; i < n && !found; i++) {
 		int j = randint0(n - i) + i;
-		int k = squares[j];
-		squares[j] = squares[i];
-		squares[i] = k;
+		int k;
+
+		/* Too many tries, so allocate the squares and shuffle in place */
+		if (!squares && (i == FIND_LAZY_TRIES)) {
+			int m;
+			squares = mem_alloc(n * sizeof(int));
+			for (m = 0; m < n; m++) squares[m] = m;
+			for (m = 0; m < num_moved; m++)
+				squares[moved_pos[m]] = moved_val[m];
+		}
+
+		if (squares) {
+			k = squares[j];
+			squares[j] = squares[i];
+			squares[i] = k;
+		} else {
+			/* Unmoved entries still hold their own index */
+			int m, val_i = i, slot_j = num_moved;
+			k = j;
+			for (m = 0; m < num_moved; m++) {
+				if (moved_pos[m] == j) {
+					k = moved_val[m];
+					slot_j = m;
+				}
+				if (moved_pos[m] == i)
+					val_i = moved_val[m];
+			}
+
+			/* Entry i is never looked at again, so only j needs recording */
+			moved_pos[slot_j] = j;
+			moved_val[slot_j] = val_i;
+			if (slot_j == num_moved) num_moved++;
+		}
 
 		*y = (k / xd) + y1;
 		*x = (k % xd) + x1;
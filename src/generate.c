@@ -419,8 +419,30 @@ static errr run_parse_room(struct parser *p) {
 	return parse_file_quit_not_found(p, "room_template");
 }
 
+/**
+ * Work out once which squares of a room template are part of the room, so
+ * that build_room_template() need not read the whole text again each time
+ */
+static void compile_room(struct room_template *t)
+{
+	size_t i, len = t->text ? strlen(t->text) : 0;
+
+	/* Text beyond the room's size is never built */
+	if (len > (size_t) t->hgt * t->wid)
+		len = (size_t) t->hgt * t->wid;
+
+	t->cells = mem_zalloc(len * sizeof(u16b));
+	for (i = 0; i < len; i++)
+		if (t->text[i] != ' ')
+			t->cells[t->num_cells++] = i;
+}
+
 static errr finish_parse_room(struct parser *p) {
+	struct room_template *t;
+
 	room_templates = parser_priv(p);
+	for (t = room_templates; t; t = t->next)
+		compile_room(t);
 	parser_destroy(p);
 	return 0;
 }
@@ -432,6 +454,7 @@ static void cleanup_room(void)
 		next = t->next;
 		mem_free(t->name);
 		mem_free(t->text);
+		mem_free(t->cells);
 		mem_free(t);
 	}
 }
@@ -566,8 +589,44 @@ static errr run_parse_vault(struct parser *p) {
 	return parse_file_quit_not_found(p, "vault");
 }
 
+/**
+ * Symbols in vault text that build_vault() places objects or monsters for
+ */
+static const char *vault_mark_symbols = "0123456789~$]|=\"!?_-,";
+
+/**
+ * Work out once which squares of a vault need more than terrain, so that
+ * build_vault() need not read the whole text again for each vault it places
+ */
+static void compile_vault(struct vault *v)
+{
+	char races[31] = "";
+	size_t i, len = v->text ? strlen(v->text) : 0;
+	int num_races = 0;
+
+	v->marks = mem_zalloc(len * sizeof(u16b));
+	for (i = 0; i < len; i++) {
+		char ch = v->text[i];
+
+		if (ch == ' ') continue;
+
+		/* Most alphabetic characters signify monster races */
+		if (isalpha((unsigned char) ch) && (ch != 'x') && (ch != 'X')) {
+			if (!strchr(races, ch) && (num_races < 30))
+				races[num_races++] = ch;
+		} else if (strchr(vault_mark_symbols, ch)) {
+			v->marks[v->num_marks++] = i;
+		}
+	}
+	v->races = string_make(races);
+}
+
 static errr finish_parse_vault(struct parser *p) {
+	struct vault *v;
+
 	vaults = parser_priv(p);
+	for (v = vaults; v; v = v->next)
+		compile_vault(v);
 	parser_destroy(p);
 	return 0;
 }
@@ -580,6 +639,8 @@ static void cleanup_vault(void)
 		mem_free(v->name);
 		mem_free(v->typ);
 		mem_free(v->text);
+		string_free(v->races);
+		mem_free(v->marks);
 		mem_free(v);
 	}
 }
@@ -215,6 +215,10 @@ struct vault {
 
     byte min_lev;		/*!< Minimum allowable level, if specified. */
     byte max_lev;		/*!< Maximum allowable level, if specified. */
+
+    char *races;		/*!< Monster race symbols, in order of first use */
+    u16b *marks;		/*!< Offsets into text of object and monster squares */
+    int num_marks;		/*!< Number of entries in marks */
 };
 
 
@@ -236,6 +240,9 @@ struct room_template {
     byte wid;			/*!< Room width */
     byte dor;           /*!< Random door options */
     byte tval;			/*!< tval for objects in this room */
+
+    u16b *cells;		/*!< Offsets into text of the squares to build */
+    int num_cells;		/*!< Number of entries in cells */
 };
 
 extern struct dun_data *dun;
@@ -156,7 +156,7 @@
 /**
  * errr is an error code
  *
- * A "byte" is an unsigned byte of memory.
+ * A "byte" is an unsigned byte of memory, and an s8b a signed one.
  * s16b/u16b are exactly 2 bytes (where possible)
  * s32b/u32b are exactly 4 bytes (where possible)
  */
@@ -165,6 +165,7 @@ typedef int errr;
 
 /* Use guaranteed-size types */
 typedef uint8_t byte;
+typedef int8_t s8b;
 
 typedef uint16_t u16b;
 typedef int16_t s16b;
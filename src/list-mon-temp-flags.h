@@ -12,4 +12,4 @@ MFLAG(MARK,		"Monster is currently memorized")
 MFLAG(VISIBLE,	"Monster is \"visible\"")
 MFLAG(UNAWARE,	"Player doesn't know this is a monster")
 MFLAG(AWARE,	"Monster is aware of the player")
-MFLAG(HANDLED,	"Monster has been processed this turn")
+MFLAG(HANDLED,	"Monster has been processed this turn (savefile only)")
@@ -24,6 +24,7 @@
 #include "init.h"
 #include "mon-lore.h"
 #include "mon-make.h"
+#include "mon-move.h"
 #include "mon-spell.h"
 #include "mon-util.h"
 #include "monster.h"
@@ -100,6 +101,7 @@ static struct object *rd_item(void)
 
 	byte tmp8u;
 	u16b tmp16u;
+	s16b tmp16s;
 	u32b ego_idx;
 	u32b art_idx;
 	byte effect;
@@ -186,7 +188,8 @@ static struct object *rd_item(void)
 	}
 
 	for (i = 0; i < elem_max; i++) {
-		rd_s16b(&obj->el_info[i].res_level);
+		rd_s16b(&tmp16s);
+		obj->el_info[i].res_level = tmp16s;
 		rd_byte(&obj->el_info[i].flags);
 	}
 
@@ -245,7 +248,8 @@ static struct object *rd_item(void)
 /**
  * Read a monster
  */
-static bool rd_monster(struct chunk *c, struct monster *mon)
+static bool rd_monster(struct chunk *c, struct monster *mon,
+					   struct monster_known *known)
 {
 	byte tmp8u;
 	u16b tmp16u;
@@ -268,15 +272,23 @@ static bool rd_monster(struct chunk *c, struct monster *mon)
 	for (j = 0; j < tmp8u; j++)
 		rd_s16b(&mon->m_timed[j]);
 
+	monster_set_energy_gain(mon);
+
 	/* Read and extract the flag */
 	for (j = 0; j < mflag_size; j++)
 		rd_byte(&mon->mflag[j]);
 
+	/* Processing this turn is saved as a flag */
+	if (mflag_has(mon->mflag, MFLAG_HANDLED)) {
+		mflag_off(mon->mflag, MFLAG_HANDLED);
+		monster_set_handled(mon);
+	}
+
 	for (j = 0; j < of_size; j++)
-		rd_byte(&mon->known_pstate.flags[j]);
+		rd_byte(&known->flags[j]);
 
 	for (j = 0; j < elem_max; j++)
-		rd_s16b(&mon->known_pstate.el_info[j].res_level);
+		rd_s16b(&known->res_level[j]);
 
 	rd_u16b(&tmp16u);
 
@@ -861,6 +873,7 @@ int rd_misc(void)
 {
 	size_t i;
 	byte tmp8u;
+	s16b tmp16s;
 	
 	/* Read the randart seed */
 	rd_u32b(&seed_randart);
@@ -898,7 +911,8 @@ int rd_misc(void)
 
 	/* Elements */
 	for (i = 0; i < ELEM_MAX; i++) {
-		rd_s16b(&player->obj_k->el_info[i].res_level);
+		rd_s16b(&tmp16s);
+		player->obj_k->el_info[i].res_level = tmp16s;
 		rd_byte(&player->obj_k->el_info[i].flags);
 	}
 
@@ -1268,13 +1282,15 @@ static int rd_monsters_aux(struct chunk *c)
 	for (i = 1; i < limit; i++) {
 		struct monster *mon;
 		struct monster monster_body;
+		struct monster_known known;
 
 		/* Get local monster */
 		mon = &monster_body;
 		memset(mon, 0, sizeof(*mon));
+		memset(&known, 0, sizeof(known));
 
 		/* Read the monster */
-		if (!rd_monster(c, mon)) {
+		if (!rd_monster(c, mon, &known)) {
 			note(format("Cannot read monster %d", i));
 			return (-1);
 		}
@@ -1284,6 +1300,9 @@ static int rd_monsters_aux(struct chunk *c)
 			note(format("Cannot place monster %d", i));
 			return (-1);
 		}
+
+		/* Remember what it knew */
+		memcpy(cave_monster_known(c, i), &known, sizeof(known));
 	}
 
 	return 0;
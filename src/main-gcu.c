@@ -129,6 +129,9 @@ static term_data data[MAX_TERM_DATA];
 /* Number of initialized "term" structures */
 static int active = 0;
 
+/* Some windows have been staged with wnoutrefresh() but not yet drawn */
+static bool update_pending = false;
+
 #ifdef A_COLOR
 
 /**
@@ -239,6 +242,16 @@ static void keymap_game_prepare(void) {
 }
 
 
+/**
+ * Send every staged window to the terminal in one go
+ */
+static void gcu_update(void) {
+	if (!update_pending) return;
+	doupdate();
+	update_pending = false;
+}
+
+
 /**
  * Suspend/Resume
  */
@@ -259,6 +272,7 @@ static errr Term_xtra_gcu_alive(int v) {
 		Term_xtra(TERM_XTRA_SHAPE, 1);
 
 		/* Flush the curses buffer */
+		gcu_update();
 		refresh();
 
 		/* Get current cursor position */
@@ -507,6 +521,9 @@ static void do_gcu_resize(void) {
 static errr Term_xtra_gcu_event(int v) {
 	int i, j, k, mods=0;
 
+	/* Show the finished frame before looking for input */
+	gcu_update();
+
 	if (v) {
 		/* Wait for a keypress; use halfdelay(1) so if the user takes more */
 		/* than 0.2 seconds we get a chance to do updates. */
@@ -515,6 +532,7 @@ static errr Term_xtra_gcu_event(int v) {
 		while (i == ERR) {
 			i = getch();
 			idle_update();
+			gcu_update();
 		}
 		cbreak();
 	} else {
@@ -737,8 +755,11 @@ static errr Term_xtra_gcu(int n, int v) {
 		/* Make a noise */
 		case TERM_XTRA_NOISE: write(1, "\007", 1); return 0;
 
-		/* Flush the Curses buffer */
-		case TERM_XTRA_FRESH: wrefresh(td->win); return 0;
+		/* Stage the window; the terminal is written once per frame */
+		case TERM_XTRA_FRESH:
+			wnoutrefresh(td->win);
+			update_pending = true;
+			return 0;
 
 #ifdef USE_CURS_SET
 		/* Change the cursor visibility */
@@ -755,7 +776,10 @@ static errr Term_xtra_gcu(int n, int v) {
 		case TERM_XTRA_FLUSH: while (!Term_xtra_gcu_event(false)); return 0;
 
 		/* Delay */
-		case TERM_XTRA_DELAY: if (v > 0) usleep(1000 * v); return 0;
+		case TERM_XTRA_DELAY:
+			gcu_update();
+			if (v > 0) usleep(1000 * v);
+			return 0;
 
 		/* React to events */
 		case TERM_XTRA_REACT: Term_xtra_gcu_react(); return 0;
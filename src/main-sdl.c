@@ -173,8 +173,16 @@ struct sdl_Font
 
 	int *data;					/* The data */
 	TTF_Font *sdl_font;			/* The native font */
+
+	SDL_Surface *atlas[MAX_COLORS * BG_MAX];	/* Pre-rendered glyphs, by attr */
 };
 
+/**
+ * The glyphs held in a font atlas (printable ASCII)
+ */
+#define ATLAS_FIRST 32
+#define ATLAS_GLYPHS 95
+
 static sdl_Font SystemFont;
 
 #define NUM_GLYPHS 256
@@ -468,11 +476,28 @@ static errr sdl_CheckFont(const char *fontname, int *width, int *height)
  * The sdl_Font routines
  */
 
+/**
+ * Free the glyph atlases, which must be rebuilt when the font, the surface
+ * format or the colours change
+ */
+static void sdl_FontFreeAtlas(sdl_Font *font)
+{
+	int i;
+
+	for (i = 0; i < MAX_COLORS * BG_MAX; i++) {
+		if (font->atlas[i]) SDL_FreeSurface(font->atlas[i]);
+		font->atlas[i] = NULL;
+	}
+}
+
 /**
  * Free any memory assigned by Create()
  */
 static void sdl_FontFree(sdl_Font *font)
 {
+	/* Finished with the glyph atlases */
+	sdl_FontFreeAtlas(font);
+
 	/* Finished with the font */
 	TTF_CloseFont(font->sdl_font);
 }
@@ -506,6 +531,9 @@ static errr sdl_FontCreate(sdl_Font *font, const char *fontname, SDL_Surface *su
 	font->bpp = surface->format->BytesPerPixel;
 	font->sdl_font = ttf_font;
 
+	/* Any glyphs rendered with the old font are stale */
+	sdl_FontFreeAtlas(font);
+
 	/* Success */
 	return (0);
 }
@@ -513,15 +541,62 @@ static errr sdl_FontCreate(sdl_Font *font, const char *fontname, SDL_Surface *su
 
 
 
+/**
+ * Get the glyph atlas for attr a, rendering it if this is the first use.
+ *
+ * The atlas is one row of cells, one per printable ASCII character, in the
+ * format of the surface it will be drawn onto so that blits need no
+ * conversion.
+ */
+static SDL_Surface *sdl_FontAtlas(sdl_Font *font, SDL_Surface *surface,
+								  int a, SDL_Color colour, SDL_Color bg)
+{
+	SDL_PixelFormat *fmt = surface->format;
+	SDL_Surface *atlas;
+	SDL_Rect src, rc;
+	char text[2] = { 0, 0 };
+	int i;
+
+	if ((a < 0) || (a >= MAX_COLORS * BG_MAX)) return NULL;
+	if (font->atlas[a]) return font->atlas[a];
+
+	atlas = SDL_CreateRGBSurface(SDL_SWSURFACE, ATLAS_GLYPHS * font->width,
+								 font->height, fmt->BitsPerPixel, fmt->Rmask,
+								 fmt->Gmask, fmt->Bmask, fmt->Amask);
+	if (!atlas) return NULL;
+
+	SDL_FillRect(atlas, NULL, SDL_MapRGB(atlas->format, bg.r, bg.g, bg.b));
+
+	/* Render each glyph as a string, so it keeps its bearing as in text */
+	for (i = 0; i < ATLAS_GLYPHS; i++) {
+		SDL_Surface *glyph;
+
+		text[0] = ATLAS_FIRST + i;
+		glyph = TTF_RenderUTF8_Shaded(font->sdl_font, text, colour, bg);
+		if (!glyph) continue;
+
+		RECT(0, 0, font->width, font->height, &src);
+		RECT(i * font->width, 0, font->width, font->height, &rc);
+		SDL_BlitSurface(glyph, &src, atlas, &rc);
+		SDL_FreeSurface(glyph);
+	}
+
+	font->atlas[a] = atlas;
+	return atlas;
+}
+
 /**
  * Draw some text onto a surface, allowing shaded backgrounds
  * The surface is first checked to see if it is compatible with
  * this font, if it isn't the the font will be 're-precalculated'
  *
+ * Plain ASCII text is copied cell by cell from the glyph atlas for attr a;
+ * anything else is rendered by the font library.
+ *
  * You can, I suppose, use one font on many surfaces, but it is
  * definitely not recommended. One font per surface is good enough.
  */
-static errr sdl_mapFontDraw(sdl_Font *font, SDL_Surface *surface,
+static errr sdl_mapFontDraw(sdl_Font *font, SDL_Surface *surface, int a,
 							SDL_Color colour, SDL_Color bg, int x, int y,
 							int n , const char *s)
 {
@@ -530,10 +605,33 @@ static errr sdl_mapFontDraw(sdl_Font *font, SDL_Surface *surface,
 
 	SDL_Rect rc;
 	SDL_Surface *text;
+	int i;
 
 	if ((bpp != font->bpp) || (pitch != font->pitch))
 		sdl_FontCreate(font, font->name, surface);
 
+	/* Use the atlas if every character is in it */
+	for (i = 0; s[i]; i++)
+		if ((s[i] < ATLAS_FIRST) || (s[i] >= ATLAS_FIRST + ATLAS_GLYPHS))
+			break;
+
+	if (!s[i]) {
+		SDL_Surface *atlas = sdl_FontAtlas(font, surface, a, colour, bg);
+
+		if (atlas) {
+			for (i = 0; s[i]; i++) {
+				SDL_Rect src;
+
+				RECT((s[i] - ATLAS_FIRST) * font->width, 0, font->width,
+					 font->height, &src);
+				RECT(x + i * font->width, y, font->width, font->height, &rc);
+				SDL_BlitSurface(atlas, &src, surface, &rc);
+			}
+
+			return (0);
+		}
+	}
+
 	/* Lock the window surface (if necessary) */
 	if (SDL_MUSTLOCK(surface))
 		if (SDL_LockSurface(surface) < 0)
@@ -2765,6 +2863,10 @@ static errr Term_xtra_sdl(int n, int v)
 				text_colours[i].g = angband_color_table[i][2];
 				text_colours[i].b = angband_color_table[i][3];
 			}
+
+			/* The glyph atlases hold the old colours */
+			for (i = 0; i < ANGBAND_TERM_MAX; i++)
+				sdl_FontFreeAtlas(&windows[i].font);
 		}
 	}
 
@@ -2846,7 +2948,7 @@ static errr Term_text_sdl(int col, int row, int n, int a, const wchar_t *s)
 	}
 
 	/* Draw it */
-	return (sdl_mapFontDraw(&win->font, win->surface, colour, bg, x, y, n,
+	return (sdl_mapFontDraw(&win->font, win->surface, a, colour, bg, x, y, n,
 							mbstr));
 }
 
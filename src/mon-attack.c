@@ -71,6 +71,7 @@ static void remove_bad_spells(struct monster *mon, bitflag f[RSF_SIZE])
 	struct element_info el[ELEM_MAX];
 
 	bool know_something = false;
+	struct monster_known *known = cave_monster_known(cave, mon->midx);
 
 	/* Stupid monsters act randomly */
 	if (rf_has(mon->race->flags, RF_STUPID)) return;
@@ -90,25 +91,21 @@ static void remove_bad_spells(struct monster *mon, bitflag f[RSF_SIZE])
 	/* Update acquired knowledge */
 	of_wipe(ai_flags);
 	pf_wipe(ai_pflags);
-	if (OPT(player, birth_ai_learn)) {
+	if (OPT(player, birth_ai_learn) && known) {
 		size_t i;
 
 		/* Occasionally forget player status */
-		if (one_in_(100)) {
-			of_wipe(mon->known_pstate.flags);
-			pf_wipe(mon->known_pstate.pflags);
-			for (i = 0; i < ELEM_MAX; i++)
-				mon->known_pstate.el_info[i].res_level = 0;
-		}
+		if (one_in_(100))
+			memset(known, 0, sizeof(*known));
 
 		/* Use the memorized info */
-		of_copy(ai_flags, mon->known_pstate.flags);
-		pf_copy(ai_pflags, mon->known_pstate.pflags);
+		of_copy(ai_flags, known->flags);
+		pf_copy(ai_pflags, known->pflags);
 		if (!of_is_empty(ai_flags) || !pf_is_empty(ai_pflags))
 			know_something = true;
 
 		for (i = 0; i < ELEM_MAX; i++) {
-			el[i].res_level = mon->known_pstate.el_info[i].res_level;
+			el[i].res_level = known->res_level[i];
 			if (el[i].res_level != 0)
 				know_something = true;
 		}
@@ -300,7 +297,8 @@ bool make_attack_spell(struct monster *mon)
 			ignore_spells(f, RST_BOLT);
 
 		/* Check for a possible summon */
-		if (!(summon_possible(mon->fy, mon->fx)))
+		if (test_spells(f, RST_SUMMON) &&
+			!(summon_possible(mon->fy, mon->fx)))
 
 			/* Remove summoning spells */
 			ignore_spells(f, RST_SUMMON);
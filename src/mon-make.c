@@ -38,6 +38,7 @@
 s16b num_repro;
 
 static s16b alloc_race_size;
+static u16b monster_gen;
 static struct alloc_entry *alloc_race_table;
 
 static void init_race_allocs(void) {
@@ -182,9 +183,11 @@ void delete_monster_idx(int m_idx)
 
 	/* Wipe the Monster */
 	memset(mon, 0, sizeof(struct monster));
+	memset(cave_monster_known(cave, m_idx), 0, sizeof(struct monster_known));
 
-	/* Count monsters */
+	/* Count monsters, and keep the slot for reuse */
 	cave->mon_cnt--;
+	cave->mon_free[cave->mon_free_num++] = m_idx;
 
 	/* Visual update */
 	square_light_spot(cave, y, x);
@@ -247,9 +250,13 @@ static void compact_monsters_aux(int i1, int i2)
 	memcpy(cave_monster(cave, i2),
 			cave_monster(cave, i1),
 			sizeof(struct monster));
+	memcpy(cave_monster_known(cave, i2),
+			cave_monster_known(cave, i1),
+			sizeof(struct monster_known));
 
 	/* Hack -- wipe hole */
 	memset(cave_monster(cave, i1), 0, sizeof(struct monster));
+	memset(cave_monster_known(cave, i1), 0, sizeof(struct monster_known));
 }
 
 
@@ -335,6 +342,9 @@ void compact_monsters(int num_to_compact)
 		/* Compress "cave->mon_max" */
 		cave->mon_max--;
 	}
+
+	/* There are no free slots left below "cave->mon_max" */
+	cave->mon_free_num = 0;
 }
 
 
@@ -379,10 +389,12 @@ void wipe_mon_list(struct chunk *c, struct player *p)
 
 		/* Wipe the Monster */
 		memset(mon, 0, sizeof(struct monster));
+		memset(cave_monster_known(c, m_idx), 0, sizeof(struct monster_known));
 	}
 
 	/* Reset "cave->mon_max" */
 	c->mon_max = 1;
+	c->mon_free_num = 0;
 
 	/* Reset "mon_cnt" */
 	c->mon_cnt = 0;
@@ -400,6 +412,9 @@ void wipe_mon_list(struct chunk *c, struct player *p)
 /**
  * Returns the index of a "free" monster, or 0 if no slot is available.
  *
+ * Slots left by dead monsters are reused first, most recent first, so the
+ * monster list stays dense without having to be compacted.
+ *
  * This routine should almost never fail, but it *can* happen.
  * The calling code must check for and handle a 0 return.
  */
@@ -407,6 +422,15 @@ s16b mon_pop(struct chunk *c)
 {
 	int m_idx;
 
+	/* Recycle dead monsters */
+	if (c->mon_free_num) {
+		/* Count monsters */
+		c->mon_cnt++;
+
+		/* Use the last monster to die */
+		return c->mon_free[--c->mon_free_num];
+	}
+
 	/* Normal allocation */
 	if (cave_monster_max(c) < z_info->level_monster_max) {
 		/* Get the next hole */
@@ -421,20 +445,6 @@ s16b mon_pop(struct chunk *c)
 		return m_idx;
 	}
 
-	/* Recycle dead monsters if we've run out of room */
-	for (m_idx = 1; m_idx < cave_monster_max(c); m_idx++) {
-		struct monster *mon = cave_monster(c, m_idx);
-
-		/* Skip live monsters */
-		if (!mon->race) {
-			/* Count monsters */
-			c->mon_cnt++;
-
-			/* Use this monster */
-			return m_idx;
-		}
-	}
-
 	/* Warn the player if no index is available */
 	if (character_dungeon)
 		msg("Too many monsters!");
@@ -525,6 +535,10 @@ struct monster_race *get_mon_num(int level)
 
 	alloc_entry *table = alloc_race_table;
 
+	/* The date only decides seasonal monsters, so look it up once */
+	time_t cur_time = time(NULL);
+	struct tm *date = localtime(&cur_time);
+
 	/* Occasionally produce a nastier monster in the dungeon */
 	if (level > 0 && one_in_(z_info->ood_monster_chance))
 		level += MIN(level / 4 + 2, z_info->ood_monster_amount);
@@ -533,9 +547,6 @@ struct monster_race *get_mon_num(int level)
 
 	/* Process probabilities */
 	for (i = 0; i < alloc_race_size; i++) {
-		time_t cur_time = time(NULL);
-		struct tm *date = localtime(&cur_time);
-
 		/* Monsters are sorted by depth */
 		if (table[i].level > level) break;
 
@@ -773,8 +784,9 @@ s16b place_monster(struct chunk *c, int y, int x, struct monster *mon,
 	new_mon = cave_monster(c, m_idx);
 	memcpy(new_mon, mon, sizeof(struct monster));
 
-	/* Set the ID */
+	/* Set the ID, and a new tag for handles to it */
 	new_mon->midx = m_idx;
+	new_mon->gen = ++monster_gen;
 
 	/* Set the location */
 	c->squares[y][x].mon = new_mon->midx;
@@ -987,6 +999,8 @@ static bool place_new_monster_one(struct chunk *c, int y, int x,
 		if (i) mon->mspeed += rand_spread(0, i);
 	}
 
+	monster_set_energy_gain(mon);
+
 	/* Give a random starting energy */
 	mon->energy = (byte)randint0(50);
 
@@ -180,30 +180,34 @@ static void find_range(struct monster *mon)
  */
 bool multiply_monster(const struct monster *mon)
 {
-	int i, y, x;
+	struct loc empty[8], grid;
+	int i, y, x, num_grids = 0, num_empty = 0;
+
+	/* Note the nearby grids, and which of them are empty */
+	for (y = mon->fy - 1; y <= mon->fy + 1; y++) {
+		for (x = mon->fx - 1; x <= mon->fx + 1; x++) {
+			if (!square_in_bounds_fully(cave, y, x)) continue;
+			num_grids++;
+			if (square_isempty(cave, y, x))
+				empty[num_empty++] = loc(x, y);
+		}
+	}
 
-	bool result = false;
+	/* Reproduction requires empty space */
+	if (!num_empty) return false;
 
-	/* Try up to 18 times */
+	/* Try up to 18 times, each picking a nearby grid as scatter() would */
 	for (i = 0; i < 18; i++) {
-		int d = 1;
-
-		/* Pick a location */
-		scatter(cave, &y, &x, mon->fy, mon->fx, d, true);
-
 		/* Require an "empty" floor grid */
-		if (!square_isempty(cave, y, x)) continue;
+		if (randint0(num_grids) >= num_empty) continue;
 
 		/* Create a new monster (awake, no groups) */
-		result = place_new_monster(cave, y, x, mon->race, false, false,
-			ORIGIN_DROP_BREED);
-
-		/* Done */
-		break;
+		grid = empty[randint0(num_empty)];
+		return place_new_monster(cave, grid.y, grid.x, mon->race, false,
+								 false, ORIGIN_DROP_BREED);
 	}
 
-	/* Result */
-	return (result);
+	return false;
 }
 
 
@@ -678,18 +682,19 @@ static bool find_hiding(struct chunk *c, struct monster *mon)
 			/* Skip occupied locations */
 			if (!square_isempty(c, y, x)) continue;
 
+			/* Calculate distance from player */
+			dis = distance(y, x, py, px);
+
+			/* Only grids closer than the best so far are of interest */
+			if (dis >= gdis || dis < min) continue;
+
 			/* Check for hidden, available grid */
 			if (!square_isview(c, y, x) &&
 				projectable(c, fy, fx, y, x, PROJECT_STOP)) {
-				/* Calculate distance from player */
-				dis = distance(y, x, py, px);
-
-				/* Remember if closer than previous */
-				if (dis < gdis && dis >= min) {
-					gy = y;
-					gx = x;
-					gdis = dis;
-				}
+				/* Remember it */
+				gy = y;
+				gx = x;
+				gdis = dis;
 			}
 		}
 
@@ -918,27 +923,37 @@ static bool monster_can_flow(struct chunk *c, struct monster *mon)
 }
 
 /**
- * Determine whether a monster is active or passive
+ * Determine whether a monster should be active or passive
  */
-static bool monster_check_active(struct chunk *c, struct monster *mon)
+static bool monster_is_active(struct chunk *c, struct monster *mon)
 {
 	/* Character is inside scanning range */
 	if (mon->cdis <= mon->race->aaf)
-		mflag_on(mon->mflag, MFLAG_ACTIVE);
+		return true;
 
 	/* Monster is hurt */
-	else if (mon->hp < mon->maxhp)
-		mflag_on(mon->mflag, MFLAG_ACTIVE);
+	if (mon->hp < mon->maxhp)
+		return true;
 
 	/* Monster can "see" the player (checked backwards) */
-	else if (square_isview(c, mon->fy, mon->fx))
-		mflag_on(mon->mflag, MFLAG_ACTIVE);
+	if (square_isview(c, mon->fy, mon->fx))
+		return true;
 
 	/* Monster can "smell" the player from far away (flow) */
-	else if (monster_can_flow(c, mon))
-		mflag_on(mon->mflag, MFLAG_ACTIVE);
+	if (monster_can_flow(c, mon))
+		return true;
 
 	/* Otherwise go passive */
+	return false;
+}
+
+/**
+ * Determine whether a monster is active or passive
+ */
+static bool monster_check_active(struct chunk *c, struct monster *mon)
+{
+	if (monster_is_active(c, mon))
+		mflag_on(mon->mflag, MFLAG_ACTIVE);
 	else
 		mflag_off(mon->mflag, MFLAG_ACTIVE);
 
@@ -1431,9 +1446,6 @@ static void process_monster(struct chunk *c, struct monster *mon)
 	bool stagger = false;
 	char m_name[80];
 
-	/* Get the monster name */
-	monster_desc(m_name, sizeof(m_name), mon, MDESC_CAPITAL | MDESC_IND_HID);
-
 	/* Try to multiply - this can use up a turn */
 	if (process_monster_multiply(c, mon))
 		return;
@@ -1448,6 +1460,9 @@ static void process_monster(struct chunk *c, struct monster *mon)
 		stagger = true;
 	}
 
+	/* Get the monster name, now that it is going to move */
+	monster_desc(m_name, sizeof(m_name), mon, MDESC_CAPITAL | MDESC_IND_HID);
+
 	/* Process moves */
 	for (i = 0; i < 5 && !did_something; i++) {
 		int oy = mon->fy;
@@ -1563,6 +1578,28 @@ static void regen_monster(struct monster *mon)
 }
 
 
+/**
+ * The generation of monster processing; it moves on every game turn, and a
+ * monster stamped with the current generation has been processed already.
+ */
+static u32b monster_generation = 1;
+
+/**
+ * Check whether a monster has been processed in this game turn
+ */
+bool monster_is_handled(const struct monster *mon)
+{
+	return mon->handled == monster_generation;
+}
+
+/**
+ * Mark a monster as processed in this game turn
+ */
+void monster_set_handled(struct monster *mon)
+{
+	mon->handled = monster_generation;
+}
+
 /**
  * Process all the "live" monsters, once per game turn.
  *
@@ -1573,15 +1610,22 @@ static void regen_monster(struct monster *mon)
  * This function and its children are responsible for a considerable fraction
  * of the processor time in normal situations, greater if the character is
  * resting.
+ *
+ * Passive monsters - asleep or awake, but too far from the player to see,
+ * hear or smell them - only gain and spend energy.  If no monster did more
+ * than that, the level's monsters are left as they were, and so there is no
+ * need to update them all afterwards.
  */
 void process_monsters(struct chunk *c, int minimum_energy)
 {
 	int i;
-	int mspeed;
 
 	/* Only process some things every so often */
 	bool regen = false;
 
+	/* Whether any monster was active */
+	bool active = false;
+
 	/* Regenerate hitpoints and mana every 100 game turns */
 	if (turn % 100 == 0)
 		regen = true;
@@ -1599,7 +1643,7 @@ void process_monsters(struct chunk *c, int minimum_energy)
 		if (!mon->race) continue;
 
 		/* Ignore monsters that have already been handled */
-		if (mflag_has(mon->mflag, MFLAG_HANDLED))
+		if (monster_is_handled(mon))
 			continue;
 
 		/* Not enough energy to move yet */
@@ -1609,21 +1653,14 @@ void process_monsters(struct chunk *c, int minimum_energy)
 		moving = mon->energy >= z_info->move_energy ? true : false;
 
 		/* Prevent reprocessing */
-		mflag_on(mon->mflag, MFLAG_HANDLED);
+		monster_set_handled(mon);
 
 		/* Handle monster regeneration if requested */
 		if (regen)
 			regen_monster(mon);
 
-		/* Calculate the net speed */
-		mspeed = mon->mspeed;
-		if (mon->m_timed[MON_TMD_FAST])
-			mspeed += 10;
-		if (mon->m_timed[MON_TMD_SLOW])
-			mspeed -= 10;
-
 		/* Give this monster some energy */
-		mon->energy += turn_energy(mspeed);
+		mon->energy += mon->energy_gain;
 
 		/* End the turn of monsters without enough energy to move */
 		if (!moving)
@@ -1637,6 +1674,8 @@ void process_monsters(struct chunk *c, int minimum_energy)
 
 		/* Check if the monster is active */
 		if (monster_check_active(c, mon)) {
+			active = true;
+
 			/* Process timed effects - skip turn if necessary */
 			if (process_monster_timed(c, mon))
 				continue;
@@ -1654,25 +1693,124 @@ void process_monsters(struct chunk *c, int minimum_energy)
 
 	/* Update monster visibility after this */
 	/* XXX This may not be necessary */
-	player->upkeep->update |= PU_MONSTERS;
+	if (active)
+		player->upkeep->update |= PU_MONSTERS;
 }
 
 /**
- * Clear 'moved' status from all monsters.
- *
- * Clear noise if appropriate.
+ * Clear 'moved' status from all monsters, by starting a new generation.
  */
 void reset_monsters(void)
+{
+	/* Skip zero, the stamp of monsters which have never been processed */
+	if (!++monster_generation)
+		monster_generation++;
+}
+
+/**
+ * Count how many game turns can pass, up to a maximum of `limit`, before any
+ * monster starts a game turn with enough energy to move.
+ *
+ * A monster which cannot move in a game turn only gains energy, so these
+ * turns can be applied in bulk by monsters_gain_energy().
+ */
+int monsters_turns_until_move(struct chunk *c, int limit)
 {
 	int i;
-	struct monster *mon;
 
-	/* Process the monsters (backwards) */
-	for (i = cave_monster_max(cave) - 1; i >= 1; i--) {
-		/* Access the monster */
-		mon = cave_monster(cave, i);
+	for (i = cave_monster_max(c) - 1; i >= 1 && limit > 0; i--) {
+		struct monster *mon = cave_monster(c, i);
+		int gain, turns;
+
+		if (!mon->race) continue;
+
+		/* This monster moves in the very next game turn */
+		if (mon->energy >= z_info->move_energy) return 0;
+
+		/* Turns until it has built up enough energy to move */
+		gain = mon->energy_gain;
+		if (gain <= 0) continue;
+		turns = (z_info->move_energy - 1 - mon->energy) / gain + 1;
+		if (turns < limit)
+			limit = turns;
+	}
+
+	return limit;
+}
+
+/**
+ * Give every monster the energy it would gain over a number of game turns
+ * in which it does not move.
+ */
+void monsters_gain_energy(struct chunk *c, int turns)
+{
+	int i;
+
+	for (i = cave_monster_max(c) - 1; i >= 1; i--) {
+		struct monster *mon = cave_monster(c, i);
+		if (!mon->race) continue;
+		mon->energy += turns * mon->energy_gain;
+	}
+}
+
+/**
+ * Check whether every monster on the level would let its turns go by without
+ * doing anything, for as long as the player stays where they are.
+ */
+bool monsters_are_dormant(struct chunk *c)
+{
+	int i;
+
+	for (i = cave_monster_max(c) - 1; i >= 1; i--) {
+		struct monster *mon = cave_monster(c, i);
+		if (!mon->race) continue;
+
+		/* Mimics lie in wait */
+		if (is_mimicking(mon)) continue;
+
+		if (monster_is_active(c, mon))
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * Run a number of game turns for dormant monsters, which just gain energy
+ * and spend it again when they have enough to move.  All monsters must be
+ * unhandled, and monsters_are_dormant() must hold.
+ */
+void monsters_pass_turns(struct chunk *c, int turns)
+{
+	int i;
+
+	for (i = cave_monster_max(c) - 1; i >= 1; i--) {
+		struct monster *mon = cave_monster(c, i);
+		int gain, left = turns;
+		bool moved = false;
+
+		if (!mon->race) continue;
+		gain = mon->energy_gain;
+
+		while (left > 0) {
+			if (mon->energy >= z_info->move_energy) {
+				/* Take a turn, doing nothing */
+				mon->energy += gain - z_info->move_energy;
+				moved = true;
+				left--;
+			} else if (gain > 0) {
+				/* Build up enough energy to move */
+				int wait = (z_info->move_energy - 1 - mon->energy) / gain + 1;
+				wait = MIN(wait, left);
+				mon->energy += wait * gain;
+				left -= wait;
+			} else {
+				break;
+			}
+		}
 
-		/* Monster is ready to go again */
-		mflag_off(mon->mflag, MFLAG_HANDLED);
+		/* Passive monsters notice that they are passive when they move */
+		if (moved && !is_mimicking(mon))
+			mflag_off(mon->mflag, MFLAG_ACTIVE);
 	}
 }
@@ -21,6 +21,12 @@
 
 bool multiply_monster(const struct monster *m);
 void process_monsters(struct chunk *c, int minimum_energy);
+bool monster_is_handled(const struct monster *mon);
+void monster_set_handled(struct monster *mon);
 void reset_monsters(void);
+int monsters_turns_until_move(struct chunk *c, int limit);
+void monsters_gain_energy(struct chunk *c, int turns);
+bool monsters_are_dormant(struct chunk *c);
+void monsters_pass_turns(struct chunk *c, int turns);
 
 #endif /* !MONSTER_MOVE_H */
@@ -339,7 +339,7 @@ static int nonhp_dam(const struct monster_spell *spell,
 	while (effect) {
 		random_value rand;
 		if (effect->dice) {
-			dice_roll(effect->dice, &rand);
+			dice_random_value(effect->dice, &rand);
 			dam += randcalc(rand, 0, dam_aspect);
 		}
 		effect = effect->next;
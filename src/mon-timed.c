@@ -207,6 +207,10 @@ static bool mon_set_timed(struct monster *mon, int ef_idx, int timer,
 	else
 		mon->m_timed[ef_idx] = timer;
 
+	/* Haste and slowness change the monster's energy */
+	if ((ef_idx == MON_TMD_FAST) || (ef_idx == MON_TMD_SLOW))
+		monster_set_energy_gain(mon);
+
 	if (player->upkeep->health_who == mon)
 		player->upkeep->redraw |= (PR_HEALTH);
 
@@ -461,6 +461,22 @@ bool monster_carry(struct chunk *c, struct monster *mon, struct object *obj)
 	return true;
 }
 
+/**
+ * Work out how much energy a monster gains each game turn from its net speed.
+ * This must be redone whenever its speed or haste/slow status changes.
+ */
+void monster_set_energy_gain(struct monster *mon)
+{
+	int mspeed = mon->mspeed;
+
+	if (mon->m_timed[MON_TMD_FAST])
+		mspeed += 10;
+	if (mon->m_timed[MON_TMD_SLOW])
+		mspeed -= 10;
+
+	mon->energy_gain = turn_energy(mspeed);
+}
+
 /**
  * Swap the players/monsters (if any) at two locations.
  */
@@ -631,6 +647,7 @@ void update_smart_learn(struct monster *m, struct player *p, int flag,
 						int pflag, int element)
 {
 	bool element_ok = ((element >= 0) && (element < ELEM_MAX));
+	struct monster_known *known;
 
 	/* Sanity check */
 	if (!flag && !element_ok) return;
@@ -652,24 +669,27 @@ void update_smart_learn(struct monster *m, struct player *p, int flag,
 	if (one_in_(100))
 		return;
 
+	/* Nowhere to remember it */
+	known = cave_monster_known(cave, m->midx);
+	if (!known) return;
+
 	/* Learn the flag */
 	if (flag) {
 		if (player_of_has(p, flag))
-			of_on(m->known_pstate.flags, flag);
+			of_on(known->flags, flag);
 		else
-			of_off(m->known_pstate.flags, flag);
+			of_off(known->flags, flag);
 	}
 
 	/* Learn the pflag */
 	if (pflag) {
 		if (pf_has(player->state.pflags, pflag))
-			of_on(m->known_pstate.pflags, pflag);
+			of_on(known->pflags, pflag);
 		else
-			of_off(m->known_pstate.pflags, pflag);
+			of_off(known->pflags, pflag);
 	}
 
 	/* Learn the element */
 	if (element_ok)
-		m->known_pstate.el_info[element].res_level
-			= player->state.el_info[element].res_level;
+		known->res_level[element] = player->state.el_info[element].res_level;
 }
@@ -30,6 +30,7 @@ bool match_monster_bases(const struct monster_base *base, ...);
 void update_mon(struct monster *mon, struct chunk *c, bool full);
 void update_monsters(bool full);
 bool monster_carry(struct chunk *c, struct monster *mon, struct object *obj);
+void monster_set_energy_gain(struct monster *mon);
 void monster_swap(int y1, int x1, int y2, int x2);
 void become_aware(struct monster *m);
 bool is_mimicking(struct monster *m);
@@ -296,11 +296,26 @@ struct monster_race {
 };
 
 
+/**
+ * What a monster has learnt about the player's defences.
+ *
+ * This is only consulted when the monster picks a spell, so it is kept out
+ * of struct monster in a side table of the level (see cave_monster_known()).
+ */
+struct monster_known {
+	bitflag flags[OF_SIZE];			/* Known object flags */
+	bitflag pflags[PF_SIZE];		/* Known player flags */
+	s16b res_level[ELEM_MAX];		/* Known resistance levels */
+};
+
 /**
  * Monster information, for a specific monster.
  *
  * Note: fy, fx constrain dungeon size to 256x256
  *
+ * The fields read by the passes over every monster each game turn come
+ * first, so that the whole monster list stays small enough to keep in cache.
+ *
  * The "held_obj" field points to the first object of a stack
  * of objects (if any) being carried by the monster (see above).
  */
@@ -311,30 +326,42 @@ struct monster {
 	byte fy;			/* Y location on map */
 	byte fx;			/* X location on map */
 
-	s16b hp;			/* Current Hit points */
-	s16b maxhp;			/* Max Hit points */
-
-	s16b m_timed[MON_TMD_MAX]; /* Timed monster status effects */
-
 	byte mspeed;		/* Monster "speed" */
 	byte energy;		/* Monster "energy" */
+	byte energy_gain;	/* Energy gained per game turn, from net speed */
 
 	byte cdis;			/* Current dis from player */
 
 	bitflag mflag[MFLAG_SIZE];	/* Temporary monster flags */
 
+	u32b handled;		/* Generation in which it was last processed */
+
+	s16b hp;			/* Current Hit points */
+	s16b maxhp;			/* Max Hit points */
+
+	s16b m_timed[MON_TMD_MAX]; /* Timed monster status effects */
+
 	struct object *mimicked_obj; /* Object this monster is mimicking */
 	struct object *held_obj;	/* Object being held (if any) */
 
 	byte attr;  		/* attr last used for drawing monster */
 
-	struct player_state known_pstate; /* Known player state */
-
     byte ty;		/**< Monster target */
     byte tx;
 
     byte min_range;	/**< What is the closest we want to be?  Not saved */
     byte best_range;	/**< How close do we want to be? Not saved */
+
+	u16b gen;			/* Tag for handles, new each time it is placed */
+};
+
+/**
+ * A reference to a monster which is safe to keep after the monster dies;
+ * the generation tag stops it finding a later occupant of the same slot.
+ */
+struct monster_handle {
+	s16b idx;
+	u16b gen;
 };
 
 /** Variables **/
@@ -413,7 +413,8 @@ static enum parser_error parse_slay_base(struct parser *p) {
 	struct slay *slay = parser_priv(p);
 
 	slay->base = string_make(base_name);
-	if (lookup_monster_base(base_name) == NULL)
+	slay->mon_base = lookup_monster_base(base_name);
+	if (slay->mon_base == NULL)
 		return PARSE_ERROR_INVALID_MONSTER_BASE;
 	/* Flag or base, not both */
 	if (slay->race_flag && slay->base)
@@ -1090,11 +1090,34 @@ void player_know_object(struct player *p, struct object *obj)
 }
 
 /**
- * Propagate player knowledge of objects to all objects
+ * Check whether learning a rune can change what is known about an object
+ *
+ * \param obj is the object
+ * \param rune_no is the rune's number in the rune list, or -1 for any rune
+ */
+static bool object_knowledge_depends(const struct object *obj, int rune_no)
+{
+	struct rune *r;
+
+	if (!obj || !obj->known) return false;
+	if (rune_no < 0) return true;
+
+	/* Egos can become known through runes the object itself lacks */
+	if (obj->ego || object_has_rune(obj, rune_no)) return true;
+
+	/* Element runes also reveal the element's ignore and hates flags */
+	r = &rune_list[rune_no];
+	return r->variety == RUNE_VAR_RESIST && obj->el_info[r->index].flags;
+}
+
+/**
+ * Propagate player knowledge of a rune to the objects that carry it
  *
  * \param p is the player
+ * \param rune_no is the rune's number in the rune list, or -1 to update
+ * every object
  */
-void update_player_object_knowledge(struct player *p)
+static void update_object_knowledge_for_rune(struct player *p, int rune_no)
 {
 	int i;
 	struct object *obj;
@@ -1102,22 +1125,26 @@ void update_player_object_knowledge(struct player *p)
 	/* Level objects */
 	if (cave)
 		for (i = 0; i < cave->obj_max; i++)
-			player_know_object(p, cave->objects[i]);
+			if (object_knowledge_depends(cave->objects[i], rune_no))
+				player_know_object(p, cave->objects[i]);
 
 	/* Player objects */
 	for (obj = p->gear; obj; obj = obj->next)
-		player_know_object(p, obj);
+		if (object_knowledge_depends(obj, rune_no))
+			player_know_object(p, obj);
 
 	/* Store objects */
 	for (i = 0; i < MAX_STORES; i++) {
 		struct store *s = &stores[i];
 		for (obj = s->stock; obj; obj = obj->next)
-			player_know_object(p, obj);
+			if (object_knowledge_depends(obj, rune_no))
+				player_know_object(p, obj);
 	}
 
 	/* Curse objects */
 	for (i = 1; i < z_info->curse_max; i++) {
-		player_know_object(player, curses[i].obj);
+		if (object_knowledge_depends(curses[i].obj, rune_no))
+			player_know_object(p, curses[i].obj);
 	}
 
 	/* Update */
@@ -1128,6 +1155,16 @@ void update_player_object_knowledge(struct player *p)
 	event_signal(EVENT_EQUIPMENT);
 }
 
+/**
+ * Propagate player knowledge of objects to all objects
+ *
+ * \param p is the player
+ */
+void update_player_object_knowledge(struct player *p)
+{
+	update_object_knowledge_for_rune(p, -1);
+}
+
 /**
  * ------------------------------------------------------------------------
  * Object knowledge learners
@@ -1248,8 +1285,8 @@ static void player_learn_rune(struct player *p, size_t i, bool message)
 	if (message)
 		msg("You have learned the rune of %s.", rune_name(i));
 
-	/* Update knowledge */
-	update_player_object_knowledge(p);
+	/* Update knowledge of the objects that carry the rune */
+	update_object_knowledge_for_rune(p, i);
 }
 
 /**
@@ -1258,7 +1295,6 @@ static void player_learn_rune(struct player *p, size_t i, bool message)
 void player_learn_flag(struct player *p, int flag)
 {
 	player_learn_rune(p, rune_index(RUNE_VAR_FLAG, flag), true);
-	update_player_object_knowledge(p);
 }
 
 /**
@@ -1270,7 +1306,6 @@ void player_learn_curse(struct player *p, struct curse *curse)
 	if (index >= 0) {
 		player_learn_rune(p, index, true);
 	}
-	update_player_object_knowledge(p);
 }
 
 /**
@@ -1701,7 +1736,6 @@ void object_learn_slay(struct player *p, struct object *obj, int index)
 
 		/* Learn the rune */
 		player_learn_rune(p, rune_index(RUNE_VAR_SLAY, i), true);
-		update_player_object_knowledge(p);
 	}
 }
 
@@ -1727,7 +1761,6 @@ void object_learn_brand(struct player *p, struct object *obj, int index)
 
 		/* Learn the rune */
 		player_learn_rune(p, rune_index(RUNE_VAR_BRAND, i), true);
-		update_player_object_knowledge(p);
 	}
 }
 
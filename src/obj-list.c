@@ -183,13 +183,14 @@ void object_list_collect(object_list_t *list)
 			x = obj->ix;
 		}
 
+		/* Skip ignored objects before the costlier line of sight check */
+		if (object_list_should_ignore_object(obj)) continue;
+
 		/* Determine which section of the list the object entry is in */
-		los = projectable(cave, py, px, y, x, PROJECT_NONE) ||
-			((y == py) && (x == px));
+		los = ((y == py) && (x == px)) ||
+			projectable(cave, py, px, y, x, PROJECT_NONE);
 		field = (los) ? OBJECT_LIST_SECTION_LOS : OBJECT_LIST_SECTION_NO_LOS;
 
-		if (object_list_should_ignore_object(obj)) continue;
-
 		/* Find or add a list entry. */
 		for (entry_index = 0; entry_index < (int)list->entries_size;
 			 entry_index++) {
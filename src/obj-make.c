@@ -38,6 +38,10 @@ static byte *obj_alloc;
 static u32b *obj_total_great;
 static byte *obj_alloc_great;
 
+/** Running totals of the above, so a draw can binary search for its kind */
+static u32b *obj_cumul;
+static u32b *obj_cumul_great;
+
 static s16b alloc_ego_size = 0;
 static alloc_entry *alloc_ego_table;
 
@@ -61,6 +65,9 @@ static void alloc_init_objects(void) {
 	obj_alloc_great = mem_zalloc((z_info->max_obj_depth + 1) * k_max * sizeof(byte));
 	obj_total = mem_zalloc((z_info->max_obj_depth + 1) * sizeof(u32b));
 	obj_total_great = mem_zalloc((z_info->max_obj_depth + 1) * sizeof(u32b));
+	obj_cumul = mem_zalloc((z_info->max_obj_depth + 1) * k_max * sizeof(u32b));
+	obj_cumul_great = mem_zalloc((z_info->max_obj_depth + 1) * k_max *
+								 sizeof(u32b));
 
 	/* Init allocation data */
 	for (item = 1; item < k_max; item++) {
@@ -87,6 +94,17 @@ static void alloc_init_objects(void) {
 			obj_alloc_great[(lev * k_max) + item] = rarity;
 		}
 	}
+
+	/* Sum the probabilities up to and including each item */
+	for (lev = 0; lev <= z_info->max_obj_depth; lev++) {
+		u32b total = 0, total_great = 0;
+		for (item = 1; item < k_max; item++) {
+			total += obj_alloc[(lev * k_max) + item];
+			total_great += obj_alloc_great[(lev * k_max) + item];
+			obj_cumul[(lev * k_max) + item] = total;
+			obj_cumul_great[(lev * k_max) + item] = total_great;
+		}
+	}
 }
 
 /*
@@ -188,6 +206,8 @@ static void cleanup_obj_make(void) {
 	}
 	mem_free(money_type);
 	mem_free(alloc_ego_table);
+	mem_free(obj_cumul_great);
+	mem_free(obj_cumul);
 	mem_free(obj_total_great);
 	mem_free(obj_total);
 	mem_free(obj_alloc_great);
@@ -1033,8 +1053,9 @@ static struct object_kind *get_obj_num_by_kind(int level, bool good, int tval)
 struct object_kind *get_obj_num(int level, bool good, int tval)
 {
 	/* This is the base index into obj_alloc for this dlev */
-	size_t ind, item;
+	size_t ind, item, lo, hi;
 	u32b value;
+	const u32b *cumul;
 
 	/* Occasional level boost */
 	if ((level > 0) && one_in_(z_info->great_obj))
@@ -1051,28 +1072,22 @@ struct object_kind *get_obj_num(int level, bool good, int tval)
 	if (tval)
 		return get_obj_num_by_kind(level, good, tval);
 	
-	if (!good) {
-		value = randint0(obj_total[level]);
-		for (item = 1; item < z_info->k_max; item++) {
-			/* Found it */
-			if (value < obj_alloc[ind + item]) break;
-
-			/* Decrement */
-			value -= obj_alloc[ind + item];
-		}
-	} else {
-		value = randint0(obj_total_great[level]);
-		for (item = 1; item < z_info->k_max; item++) {
-			/* Found it */
-			if (value < obj_alloc_great[ind + item]) break;
-
-			/* Decrement */
-			value -= obj_alloc_great[ind + item];
-		}
+	value = randint0(good ? obj_total_great[level] : obj_total[level]);
+	cumul = (good ? obj_cumul_great : obj_cumul) + ind;
+
+	/* Find the first item whose running total passes the value */
+	lo = 1;
+	hi = z_info->k_max;
+	while (lo < hi) {
+		item = (lo + hi) / 2;
+		if (value < cumul[item])
+			hi = item;
+		else
+			lo = item + 1;
 	}
 
 	/* Return the item index */
-	return objkind_byid(item);
+	return objkind_byid(lo);
 }
 
 
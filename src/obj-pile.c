@@ -302,6 +302,16 @@ bool object_stackable(const struct object *obj1, const struct object *obj2,
 {
 	int i;
 
+	/* Hack -- identical items cannot be stacked */
+	if (obj1 == obj2) return false;
+
+	/* Require identical object kinds; this rules out most pairs, so do it
+	 * before any of the more expensive checks */
+	if (obj1->kind != obj2->kind) return false;
+
+	/* Artifacts never stack */
+	if (obj1->artifact || obj2->artifact) return false;
+
 	/* Equipment items don't stack */
 	if (object_is_equipped(player->body, obj1))
 		return false;
@@ -312,12 +322,6 @@ bool object_stackable(const struct object *obj1, const struct object *obj2,
 	if (mode & OSTACK_LIST && obj1->kind != obj1->known->kind) return false;
 	if (mode & OSTACK_LIST && obj2->kind != obj2->known->kind) return false;
 
-	/* Hack -- identical items cannot be stacked */
-	if (obj1 == obj2) return false;
-
-	/* Require identical object kinds */
-	if (obj1->kind != obj2->kind) return false;
-
 	/* Different flags don't stack */
 	if (!of_is_equal(obj1->flags, obj2->flags)) return false;
 
@@ -330,9 +334,6 @@ bool object_stackable(const struct object *obj1, const struct object *obj2,
 			return false;
 	}
 
-	/* Artifacts never stack */
-	if (obj1->artifact || obj2->artifact) return false;
-
 	/* Analyze the items */
 	if (tval_is_chest(obj1)) {
 		/* Chests never stack */
@@ -537,17 +538,18 @@ void object_copy(struct object *dest, const struct object *src)
 	/* Copy the structure */
 	memcpy(dest, src, sizeof(struct object));
 
+	/* The arrays are overwritten in full, so need no zeroing */
 	if (src->slays) {
-		dest->slays = mem_zalloc(z_info->slay_max * sizeof(bool));
+		dest->slays = mem_alloc(z_info->slay_max * sizeof(bool));
 		memcpy(dest->slays, src->slays, z_info->slay_max * sizeof(bool));
 	}
 	if (src->brands) {
-		dest->brands = mem_zalloc(z_info->brand_max * sizeof(bool));
+		dest->brands = mem_alloc(z_info->brand_max * sizeof(bool));
 		memcpy(dest->brands, src->brands, z_info->brand_max * sizeof(bool));
 	}
 	if (src->curses) {
 		size_t array_size = z_info->curse_max * sizeof(struct curse_data);
-		dest->curses = mem_zalloc(array_size);
+		dest->curses = mem_alloc(array_size);
 		memcpy(dest->curses, src->curses, array_size);
 	}
 
@@ -836,13 +838,13 @@ static void drop_find_grid(struct object *drop, int *y, int *x)
 			int num_ignored = 0;
 			int score;
 
-			/* Lots of reasons to say no */
+			/* Lots of reasons to say no, line of sight being the costliest */
 			if ((dist > 10) ||
 				!square_in_bounds_fully(cave, ty, tx) ||
-				!los(cave, *y, *x, ty, tx) ||
 				!square_isfloor(cave, ty, tx) ||
 				square_isplayertrap(cave, ty, tx) ||
-				square_iswarded(cave, ty, tx))
+				square_iswarded(cave, ty, tx) ||
+				!los(cave, *y, *x, ty, tx))
 				continue;
 
 			/* Analyse the grid for carrying the new object */
@@ -130,12 +130,29 @@ static s16b ability_power[25] =
 /* Log file declared here for simplicity */
 static ang_file *object_log;
 
+/**
+ * Equipment slot of the object being rated, and whether that is the
+ * launcher slot; found once per object_power() call since the slot lookups
+ * compare slot names
+ */
+static int rated_slot;
+static bool rated_shoots;
+
 /**
  * Log progress info to the object log
+ *
+ * Nothing is formatted unless there is a log file, as object_power() is
+ * usually called without one.
  */
-void log_obj(char *message)
+static void log_obj(const char *fmt, ...)
 {
-	file_putf(object_log, message);
+	va_list vp;
+
+	if (!object_log) return;
+
+	va_start(vp, fmt);
+	file_vputf(object_log, fmt, vp);
+	va_end(vp);
 }
 
 /**
@@ -150,7 +167,7 @@ static int bow_multiplier(const struct object *obj)
 	else
 		mult = obj->pval;
 
-	log_obj(format("Base mult for this weapon is %d\n", mult));
+	log_obj("Base mult for this weapon is %d\n", mult);
 	return mult;
 }
 
@@ -162,16 +179,16 @@ static int to_damage_power(const struct object *obj)
 	int p;
 
 	p = (obj->to_d * DAMAGE_POWER / 2);
-	if (p) log_obj(format("%d power from to_dam\n", p));
+	if (p) log_obj("%d power from to_dam\n", p);
 
 	/* Add second lot of damage power for non-weapons */
-	if ((wield_slot(obj) != slot_by_name(player, "shooting")) &&
+	if (!rated_shoots &&
 		!tval_is_melee_weapon(obj) &&
 		!tval_is_ammo(obj)) {
 		int q = (obj->to_d * DAMAGE_POWER);
 		p += q;
 		if (q)
-			log_obj(format("Add %d from non-weapon to_dam, total %d\n", q, p));
+			log_obj("Add %d from non-weapon to_dam, total %d\n", q, p);
 	}
 	return p;
 }
@@ -186,16 +203,16 @@ static int damage_dice_power(const struct object *obj)
 	/* Add damage from dice for any wieldable weapon or ammo */
 	if (tval_is_melee_weapon(obj) || tval_is_ammo(obj)) {
 		dice = (obj->dd * (obj->ds + 1) * DAMAGE_POWER / 4);
-		log_obj(format("Add %d power for damage dice, ", dice));
-	} else if (wield_slot(obj) != slot_by_name(player, "shooting")) {
+		log_obj("Add %d power for damage dice, ", dice);
+	} else if (!rated_shoots) {
 		/* Add power boost for nonweapons with combat flags */
 		if (obj->brands || obj->slays ||
 			(obj->modifiers[OBJ_MOD_BLOWS] > 0) ||
 			(obj->modifiers[OBJ_MOD_SHOTS] > 0) ||
 			(obj->modifiers[OBJ_MOD_MIGHT] > 0)) {
 			dice = (WEAP_DAMAGE * DAMAGE_POWER);
-			log_obj(format("Add %d power for non-weapon combat bonuses, ",
-						   dice));
+			log_obj("Add %d power for non-weapon combat bonuses, ",
+					dice);
 		}
 	}
 	return dice;
@@ -209,7 +226,7 @@ static int ammo_damage_power(const struct object *obj, int p)
 	int q = 0;
 	int launcher = -1;
 
-	if (wield_slot(obj) == slot_by_name(player, "shooting")) {
+	if (rated_shoots) {
 		if (kf_has(obj->kind->kind_flags, KF_SHOOTS_SHOTS))
 			launcher = 0;
 		else if (kf_has(obj->kind->kind_flags, KF_SHOOTS_ARROWS))
@@ -219,8 +236,8 @@ static int ammo_damage_power(const struct object *obj, int p)
 
 		if (launcher != -1) {
 			q = (archery[launcher].ammo_dam * DAMAGE_POWER / 2);
-			log_obj(format("Adding %d power from ammo, total is %d\n", q,
-						   p + q));
+			log_obj("Adding %d power from ammo, total is %d\n", q,
+					p + q);
 		}
 	}
 	return q;
@@ -239,8 +256,8 @@ static int launcher_ammo_damage_power(const struct object *obj, int p)
 		if (obj->ego)
 			p += (archery[ammo_type].launch_dam * DAMAGE_POWER / 2);
 		p = p * archery[ammo_type].launch_mult / (2 * MAX_BLOWS);
-		log_obj(format("After multiplying ammo and rescaling, power is %d\n",
-					   p));
+		log_obj("After multiplying ammo and rescaling, power is %d\n",
+				p);
 	}
 	return p;
 }
@@ -264,8 +281,8 @@ static int extra_blows_power(const struct object *obj, int p)
 		/* Add boost for assumed off-weapon damage */
 		p += (NONWEAP_DAMAGE * obj->modifiers[OBJ_MOD_BLOWS]
 			  * DAMAGE_POWER / 2);
-		log_obj(format("Add %d power for extra blows, total is %d\n",
-					   p - q, p));
+		log_obj("Add %d power for extra blows, total is %d\n",
+				p - q, p);
 	}
 	return p;
 }
@@ -285,8 +302,8 @@ static int extra_shots_power(const struct object *obj, int p)
 	} else if (obj->modifiers[OBJ_MOD_SHOTS] > 0) {
 		int q = obj->modifiers[OBJ_MOD_SHOTS];
 		p = p * (1 + q);
-		log_obj(format("Multiplying power by %d for extra shots, total is %d\n",
-					   1 + q, p));
+		log_obj("Multiplying power by %d for extra shots, total is %d\n",
+				1 + q, p);
 	}
 	return p;
 }
@@ -304,9 +321,9 @@ static int extra_might_power(const struct object *obj, int p, int mult)
 	} else {
 		mult += obj->modifiers[OBJ_MOD_MIGHT];
 	}
-	log_obj(format("Mult after extra might is %d\n", mult));
+	log_obj("Mult after extra might is %d\n", mult);
 	p *= mult;
-	log_obj(format("After multiplying power for might, total is %d\n", p));
+	log_obj("After multiplying power for might, total is %d\n", p);
 	return p;
 }
 
@@ -356,7 +373,7 @@ static s32b slay_power(const struct object *obj, int p, int verbose,
 			for (i = 1; i < z_info->brand_max; i++) {
 				if (obj->brands[i]) {
 					struct brand *b = &brands[i];
-					log_obj(format("%sx%d ", b->name, b->multiplier));
+					log_obj("%sx%d ", b->name, b->multiplier);
 				}
 			}
 		}
@@ -364,49 +381,49 @@ static s32b slay_power(const struct object *obj, int p, int verbose,
 			for (i = 1; i < z_info->slay_max; i++) {
 				if (obj->slays[i]) {
 					struct slay *s = &slays[i];
-					log_obj(format("%sx%d ", s->name, s->multiplier));
+					log_obj("%sx%d ", s->name, s->multiplier);
 				}
 			}
 		}
-		log_obj(format("\nbest power is : %d\n", best_power));
+		log_obj("\nbest power is : %d\n", best_power);
 	}
 
 	q = (dice_pwr * (best_power - 100)) / 100;
 	p += q;
-	log_obj(format("Add %d for slay power, total is %d\n", q, p));
+	log_obj("Add %d for slay power, total is %d\n", q, p);
 
 	/* Bonuses for multiple brands and slays */
 	if (num_slays > 1) {
 		q = (num_slays * num_slays * dice_pwr) / (DAMAGE_POWER * 5);
 		p += q;
-		log_obj(format("Add %d power for multiple slays, total is %d\n", q, p));
+		log_obj("Add %d power for multiple slays, total is %d\n", q, p);
 	}
 	if (num_brands > 1) {
 		q = (2 * num_brands * num_brands * dice_pwr) / (DAMAGE_POWER * 5);
 		p += q;
-		log_obj(format("Add %d power for multiple brands, total is %d\n",q, p));
+		log_obj("Add %d power for multiple brands, total is %d\n",q, p);
 	}
 	if (num_slays && num_brands) {
 		q = (num_slays * num_brands * dice_pwr) / (DAMAGE_POWER * 5);
 		p += q;
-		log_obj(format("Add %d power for slay and brand, total is %d\n", q, p));
+		log_obj("Add %d power for slay and brand, total is %d\n", q, p);
 	}
 	if (num_kills > 1) {
 		q = (3 * num_kills * num_kills * dice_pwr) / (DAMAGE_POWER * 5);
 		p += q;
-		log_obj(format("Add %d power for multiple kills, total is %d\n", q, p));
+		log_obj("Add %d power for multiple kills, total is %d\n", q, p);
 	}
 	if (num_slays == 8) {
 		p += 10;
-		log_obj(format("Add 10 power for full set of slays, total is %d\n", p));
+		log_obj("Add 10 power for full set of slays, total is %d\n", p);
 	}
 	if (num_brands == 5) {
 		p += 20;
-		log_obj(format("Add 20 power for full set of brands, total is %d\n",p));
+		log_obj("Add 20 power for full set of brands, total is %d\n",p);
 	}
 	if (num_kills == 3) {
 		p += 20;
-		log_obj(format("Add 20 power for full set of kills, total is %d\n", p));
+		log_obj("Add 20 power for full set of kills, total is %d\n", p);
 	}
 
 	return p;
@@ -418,9 +435,9 @@ static s32b slay_power(const struct object *obj, int p, int verbose,
  */
 static int rescale_bow_power(const struct object *obj, int p)
 {
-	if (wield_slot(obj) == slot_by_name(player, "shooting")) {
+	if (rated_shoots) {
 		p /= MAX_BLOWS;
-		log_obj(format("Rescaling bow power, total is %d\n", p));
+		log_obj("Rescaling bow power, total is %d\n", p);
 	}
 	return p;
 }
@@ -433,7 +450,7 @@ static int to_hit_power(const struct object *obj, int p)
 	int q = (obj->to_h * TO_HIT_POWER / 2);
 	p += q;
 	if (p) 
-		log_obj(format("Add %d power for to hit, total is %d\n", q, p));
+		log_obj("Add %d power for to hit, total is %d\n", q, p);
 	return p;
 }
 
@@ -447,7 +464,7 @@ static int ac_power(const struct object *obj, int p)
 	if (obj->ac) {
 		p += BASE_ARMOUR_POWER;
 		q += (obj->ac * BASE_AC_POWER / 2);
-		log_obj(format("Adding %d power for base AC value\n", q));
+		log_obj("Adding %d power for base AC value\n", q);
 
 		/* Add power for AC per unit weight */
 		if (obj->weight > 0) {
@@ -463,7 +480,7 @@ static int ac_power(const struct object *obj, int p)
 		} else
 			q *= 5;
 		p += q;
-		log_obj(format("Add %d power for AC per unit weight, now %d\n",	q, p));
+		log_obj("Add %d power for AC per unit weight, now %d\n",	q, p);
 	}
 	return p;
 }
@@ -480,18 +497,18 @@ static int to_ac_power(const struct object *obj, int p)
 
 	q = (obj->to_a * TO_AC_POWER / 2);
 	p += q;
-	log_obj(format("Add %d power for to_ac of %d, total is %d\n", 
-				   q, obj->to_a, p));
+	log_obj("Add %d power for to_ac of %d, total is %d\n", 
+			q, obj->to_a, p);
 	if (obj->to_a > HIGH_TO_AC) {
 		q = ((obj->to_a - (HIGH_TO_AC - 1)) * TO_AC_POWER);
 		p += q;
-		log_obj(format("Add %d power for high to_ac, total is %d\n",
-							q, p));
+		log_obj("Add %d power for high to_ac, total is %d\n",
+				q, p);
 	}
 	if (obj->to_a > VERYHIGH_TO_AC) {
 		q = ((obj->to_a - (VERYHIGH_TO_AC -1)) * TO_AC_POWER * 2);
 		p += q;
-		log_obj(format("Add %d power for very high to_ac, total is %d\n",q, p));
+		log_obj("Add %d power for very high to_ac, total is %d\n",q, p);
 	}
 	if (obj->to_a >= INHIBIT_AC) {
 		p += INHIBIT_POWER;
@@ -507,8 +524,8 @@ static int jewelry_power(const struct object *obj, int p)
 {
 	if (tval_is_jewelry(obj)) {
 		p += BASE_JEWELRY_POWER;
-		log_obj(format("Adding %d power for jewelry, total is %d\n", 
-					   BASE_JEWELRY_POWER, p));
+		log_obj("Adding %d power for jewelry, total is %d\n", 
+				BASE_JEWELRY_POWER, p);
 	}
 	return p;
 }
@@ -525,24 +542,24 @@ static int modifier_power(const struct object *obj, int p)
 		extra_stat_bonus += (k * mod_mult(i));
 
 		if (mod_power(i)) {
-			q = (k * mod_power(i) * mod_slot_mult(i, wield_slot(obj)));
+			q = (k * mod_power(i) * mod_slot_mult(i, rated_slot));
 			p += q;
-			if (q) log_obj(format("Add %d power for %d %s, total is %d\n", 
-								  q, k, mod_name(i), p));
+			if (q) log_obj("Add %d power for %d %s, total is %d\n", 
+						   q, k, mod_name(i), p);
 		}
 	}
 
 	/* Add extra power term if there are a lot of ability bonuses */
 	if (extra_stat_bonus > 249) {
-		log_obj(format("Inhibiting - Total ability bonus of %d is too high\n", 
-					   extra_stat_bonus));
+		log_obj("Inhibiting - Total ability bonus of %d is too high\n", 
+				extra_stat_bonus);
 		p += INHIBIT_POWER;
 	} else if (extra_stat_bonus > 0) {
 		q = ability_power[extra_stat_bonus / 10];
 		if (!q) return p;
 		p += q;
-		log_obj(format("Add %d power for modifier total of %d, total is %d\n", 
-					   q, extra_stat_bonus, p));
+		log_obj("Add %d power for modifier total of %d, total is %d\n", 
+				q, extra_stat_bonus, p);
 	}
 	return p;
 }
@@ -571,10 +588,10 @@ static int flags_power(const struct object *obj, int p, int verbose,
 	for (i = of_next(flags, FLAG_START); i != FLAG_END; 
 		 i = of_next(flags, i + 1)) {
 		if (flag_power(i)) {
-			q = (flag_power(i) * flag_slot_mult(i, wield_slot(obj)));
+			q = (flag_power(i) * flag_slot_mult(i, rated_slot));
 			p += q;
-			log_obj(format("Add %d power for %s, total is %d\n", 
-						   q, flag_name(i), p));
+			log_obj("Add %d power for %s, total is %d\n", 
+					q, flag_name(i), p);
 		}
 
 		/* Track combinations of flag types */
@@ -588,16 +605,16 @@ static int flags_power(const struct object *obj, int p, int verbose,
 		if (flag_sets[i].count > 1) {
 			q = (flag_sets[i].factor * flag_sets[i].count * flag_sets[i].count);
 			p += q;
-			log_obj(format("Add %d power for multiple %s, total is %d\n",
-						   q, flag_sets[i].desc, p));
+			log_obj("Add %d power for multiple %s, total is %d\n",
+					q, flag_sets[i].desc, p);
 		}
 
 		/* Add bonus if item has a full set of these flags */
 		if (flag_sets[i].count == flag_sets[i].size) {
 			q = flag_sets[i].bonus;
 			p += q;
-			log_obj(format("Add %d power for full set of %s, total is %d\n", 
-						   q, flag_sets[i].desc, p));
+			log_obj("Add %d power for full set of %s, total is %d\n", 
+					q, flag_sets[i].desc, p);
 		}
 	}
 
@@ -622,8 +639,8 @@ static int element_power(const struct object *obj, int p)
 			if (el_powers[i].ignore_power != 0) {
 				q = (el_powers[i].ignore_power);
 				p += q;
-				log_obj(format("Add %d power for ignoring %s, total is %d\n",
-							   q, el_powers[i].name, p));
+				log_obj("Add %d power for ignoring %s, total is %d\n",
+						q, el_powers[i].name, p);
 			}
 		}
 
@@ -631,20 +648,20 @@ static int element_power(const struct object *obj, int p)
 			if (el_powers[i].vuln_power != 0) {
 				q = (el_powers[i].vuln_power);
 				p += q;
-				log_obj(format("Add %d power for vulnerability to %s, total is %d\n", q, el_powers[i].name, p));
+				log_obj("Add %d power for vulnerability to %s, total is %d\n", q, el_powers[i].name, p);
 			}
 		} else if (obj->el_info[i].res_level == 1) {
 			if (el_powers[i].res_power != 0) {
 				q = (el_powers[i].res_power);
 				p += q;
-				log_obj(format("Add %d power for resistance to %s, total is %d\n", q, el_powers[i].name, p));
+				log_obj("Add %d power for resistance to %s, total is %d\n", q, el_powers[i].name, p);
 			}
 		} else if (obj->el_info[i].res_level == 3) {
 			if (el_powers[i].im_power != 0) {
 				q = (el_powers[i].im_power + el_powers[i].res_power);
 				p += q;
-				log_obj(format("Add %d power for immunity to %s, total is %d\n",
-							   q, el_powers[i].name, p));
+				log_obj("Add %d power for immunity to %s, total is %d\n",
+						q, el_powers[i].name, p);
 			}
 		}
 
@@ -660,16 +677,16 @@ static int element_power(const struct object *obj, int p)
 		if (element_sets[i].count > 1) {
 			q = (element_sets[i].factor * element_sets[i].count * element_sets[i].count);
 			p += q;
-			log_obj(format("Add %d power for multiple %s, total is %d\n",
-						   q, element_sets[i].desc, p));
+			log_obj("Add %d power for multiple %s, total is %d\n",
+					q, element_sets[i].desc, p);
 		}
 
 		/* Add bonus if item has a full set of these flags */
 		if (element_sets[i].count == element_sets[i].size) {
 			q = element_sets[i].bonus;
 			p += q;
-			log_obj(format("Add %d power for full set of %s, total is %d\n", 
-						   q, element_sets[i].desc, p));
+			log_obj("Add %d power for full set of %s, total is %d\n", 
+					q, element_sets[i].desc, p);
 		}
 	}
 
@@ -692,12 +709,37 @@ static int effects_power(const struct object *obj, int p)
 
 	if (q) {
 		p += q;
-		log_obj(format("Add %d power for item activation, total is %d\n",
-					   q, p));
+		log_obj("Add %d power for item activation, total is %d\n",
+				q, p);
 	}
 	return p;
 }
 
+/**
+ * Power of the object describing a curse, which never changes once the curse
+ * has been read from curse.txt, so only needs working out once
+ */
+static int curse_object_power(int index)
+{
+	struct curse *curse = &curses[index];
+
+	if (!curse->obj_power_known) {
+		ang_file *log_file = object_log;
+		int slot = rated_slot;
+		bool shoots = rated_shoots;
+
+		curse->obj_power = object_power(curse->obj, false, NULL);
+		curse->obj_power_known = true;
+
+		/* Carry on with the object we were rating */
+		object_log = log_file;
+		rated_slot = slot;
+		rated_shoots = shoots;
+	}
+
+	return curse->obj_power;
+}
+
 /**
  * Add power for curses
  */
@@ -709,7 +751,7 @@ static int curse_power(const struct object *obj, int p)
 		/* Get the curse object power */
 		for (i = 1; i < z_info->curse_max; i++) {
 			if (obj->curses[i].power) {
-				q += object_power(curses[i].obj, false, NULL);
+				q += curse_object_power(i);
 				q -= obj->curses[i].power / 10;
 			}
 		}
@@ -717,8 +759,8 @@ static int curse_power(const struct object *obj, int p)
 
 	if (q != 0) {
 		p += q;
-		log_obj(format("Add %d power for curses, total is %d\n",
-					   q, p));
+		log_obj("Add %d power for curses, total is %d\n",
+				q, p);
 	}
 	return p;
 }
@@ -735,11 +777,15 @@ s32b object_power(const struct object* obj, bool verbose, ang_file *log_file)
 	/* Set the log file */
 	object_log = log_file;
 
+	/* Find the slot the object goes in */
+	rated_slot = wield_slot(obj);
+	rated_shoots = (rated_slot == slot_by_name(player, "shooting"));
+
 	/* Get all the attack power */
 	p = to_damage_power(obj);
 	dice_pwr = damage_dice_power(obj);
 	p += dice_pwr;
-	if (dice_pwr) log_obj(format("total is %d\n", p));
+	if (dice_pwr) log_obj("total is %d\n", p);
 	p += ammo_damage_power(obj, p);
 	mult = bow_multiplier(obj);
 	p = launcher_ammo_damage_power(obj, p);
@@ -767,7 +813,7 @@ s32b object_power(const struct object* obj, bool verbose, ang_file *log_file)
 	p = effects_power(obj, p);
 	p = curse_power(obj, p);
 
-	log_obj(format("FINAL POWER IS %d\n", p));
+	log_obj("FINAL POWER IS %d\n", p);
 
 	return p;
 }
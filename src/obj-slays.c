@@ -36,11 +36,7 @@ struct brand *brands;
 bool same_monsters_slain(int slay1, int slay2)
 {
 	if (slays[slay1].race_flag != slays[slay2].race_flag) return false;
-	if (!slays[slay1].base && !slays[slay2].base) return true;
-	if (slays[slay1].base && !slays[slay2].base) return false;
-	if (!slays[slay1].base && slays[slay2].base) return false;
-	if (streq(slays[slay1].base, slays[slay2].base)) return true;
-	return false;
+	return slays[slay1].mon_base == slays[slay2].mon_base;
 }
 
 /**
@@ -223,7 +219,7 @@ bool react_to_specific_slay(struct slay *slay, const struct monster *mon)
 		return true;
 
 	/* Check for monster base */
-	if (slay->base && streq(slay->base, mon->race->base->name))
+	if (slay->mon_base && (slay->mon_base == mon->race->base))
 		return true;
 
 	return false;
@@ -251,9 +247,9 @@ void improve_attack_modifier(struct object *obj, const struct monster *mon,
 	if (!obj) return;
 
 	/* Brands */
-	for (i = 1; i < z_info->brand_max; i++) {
+	for (i = 1; obj->brands && i < z_info->brand_max; i++) {
 		struct brand *b = &brands[i];
-		if (!obj->brands || !obj->brands[i]) continue;
+		if (!obj->brands[i]) continue;
  
 		/* Is the monster is vulnerable? */
 		if (!rf_has(mon->race->flags, b->resist_flag)) {
@@ -282,9 +278,9 @@ void improve_attack_modifier(struct object *obj, const struct monster *mon,
 	}
 
 	/* Slays */
-	for (i = 1; i < z_info->slay_max; i++) {
+	for (i = 1; obj->slays && i < z_info->slay_max; i++) {
 		struct slay *s = &slays[i];
-		if (!obj->slays || !obj->slays[i]) continue;
+		if (!obj->slays[i]) continue;
  
 		/* Is the monster is vulnerable? */
 		if (react_to_specific_slay(s, mon)) {
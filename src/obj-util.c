@@ -808,6 +808,41 @@ bool recharge_timeout(struct object *obj)
 		return false;
 }
 
+/**
+ * Count the calls to recharge_timeout() it will take before something in
+ * the stack gains a charge, or 0 if nothing is charging.
+ */
+int recharge_timeout_turns(const struct object *obj)
+{
+	int charging = number_charging(obj);
+	int charge_time;
+
+	if (!charging) return 0;
+
+	/* One fewer item is charging once the timeout drops to this */
+	charge_time = randcalc(obj->time, 0, AVERAGE);
+	return (obj->timeout - (charging - 1) * charge_time + charging - 1) /
+		charging;
+}
+
+/**
+ * Recharge a stack as if by `turns` calls to recharge_timeout()
+ */
+void recharge_timeout_many(struct object *obj, int turns)
+{
+	while (turns > 0) {
+		int charging = number_charging(obj);
+		int step = MIN(recharge_timeout_turns(obj), turns);
+
+		/* Nothing to charge */
+		if (!charging) return;
+
+		/* The same number charge every turn until one is done */
+		obj->timeout -= MIN(step * charging, obj->timeout);
+		turns -= step;
+	}
+}
+
 /**
  * Verify the choice of an item.
  *
@@ -60,6 +60,8 @@ int get_use_device_chance(const struct object *obj);
 void distribute_charges(struct object *source, struct object *dest, int amt);
 int number_charging(const struct object *obj);
 bool recharge_timeout(struct object *obj);
+int recharge_timeout_turns(const struct object *obj);
+void recharge_timeout_many(struct object *obj, int turns);
 bool verify_object(const char *prompt, struct object *obj);
 
 
@@ -76,6 +76,7 @@ struct slay {
 	char *code;
 	char *name;
 	char *base;
+	struct monster_base *mon_base;	/* The monster base named by base */
 	char *melee_verb;
 	char *range_verb;
 	int race_flag;
@@ -94,6 +95,8 @@ struct curse {
 	struct object *obj;
 	int power;
 	char *desc;
+	int obj_power;			/* object_power() of obj, once worked out */
+	bool obj_power_known;
 };
 
 enum {
@@ -106,7 +109,7 @@ enum {
  * Element info type
  */
 struct element_info {
-	s16b res_level;
+	s8b res_level;		/* -1 vulnerable, 1 resistant, 3 immune */
 	bitflag flags;
 };
 
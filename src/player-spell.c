@@ -511,7 +511,7 @@ static void spell_append_value_info(int spell_index, char *p, size_t len)
 	type = effect_info(spell->effect);
 
 	if (spell->effect->dice != NULL)
-		dice_roll(spell->effect->dice, &rv);
+		dice_random_value(spell->effect->dice, &rv);
 
 	/* Handle some special cases where we want to append some additional info */
 	switch (spell->effect->index) {
@@ -236,15 +236,11 @@ s16b modify_stat_value(int value, int amount)
 }
 
 /**
- * Regenerate hit points
+ * Hit points regenerated per world tick, multiplied by 2^16
  */
-void player_regen_hp(struct player *p)
+static s32b player_regen_hp_amount(struct player *p)
 {
-	s32b new_chp, new_chp_frac;
-	int old_chp, percent = 0;
-
-	/* Save the old hitpoints */
-	old_chp = p->chp;
+	int percent = 0;
 
 	/* Default regeneration */
 	if (p->food >= PY_FOOD_WEAK)
@@ -270,8 +266,22 @@ void player_regen_hp(struct player *p)
 	if (p->timed[TMD_STUN]) percent = 0;
 	if (p->timed[TMD_CUT]) percent = 0;
 
+	return ((long)p->mhp) * percent + PY_REGEN_HPBASE;
+}
+
+/**
+ * Regenerate hit points
+ */
+void player_regen_hp(struct player *p)
+{
+	s32b new_chp, new_chp_frac;
+	int old_chp;
+
+	/* Save the old hitpoints */
+	old_chp = p->chp;
+
 	/* Extract the new hitpoints */
-	new_chp = ((long)p->mhp) * percent + PY_REGEN_HPBASE;
+	new_chp = player_regen_hp_amount(p);
 	p->chp += (s16b)(new_chp >> 16);   /* div 65536 */
 
 	/* Check for overflow */
@@ -301,15 +311,11 @@ void player_regen_hp(struct player *p)
 
 
 /**
- * Regenerate mana points
+ * Spell points regenerated per world tick, multiplied by 2^16
  */
-void player_regen_mana(struct player *p)
+static s32b player_regen_mana_amount(struct player *p)
 {
-	s32b new_mana, new_mana_frac;
-	int old_csp, percent;
-
-	/* Save the old spell points */
-	old_csp = p->csp;
+	int percent;
 
 	/* Default regeneration */
 	percent = PY_REGEN_NORMAL;
@@ -324,8 +330,22 @@ void player_regen_mana(struct player *p)
 	if (player_of_has(p, OF_IMPAIR_MANA))
 		percent /= 2;
 
+	return ((long)p->msp) * percent + PY_REGEN_MNBASE;
+}
+
+/**
+ * Regenerate mana points
+ */
+void player_regen_mana(struct player *p)
+{
+	s32b new_mana, new_mana_frac;
+	int old_csp;
+
+	/* Save the old spell points */
+	old_csp = p->csp;
+
 	/* Regenerate mana */
-	new_mana = ((long)p->msp) * percent + PY_REGEN_MNBASE;
+	new_mana = player_regen_mana_amount(p);
 	p->csp += (s16b)(new_mana >> 16);	/* div 65536 */
 
 	/* check for overflow */
@@ -355,58 +375,126 @@ void player_regen_mana(struct player *p)
 }
 
 /**
- * Update the player's light fuel
+ * Count the world ticks of regeneration before hit points or spell points
+ * that are not yet full would become full, or -1 if both are full already.
  */
-void player_update_light(struct player *p)
+int player_regen_turns(struct player *p)
+{
+	int turns = -1;
+
+	if (p->chp < p->mhp) {
+		s32b left = ((s32b)(p->mhp - p->chp) << 16) - p->chp_frac;
+		s32b amount = player_regen_hp_amount(p);
+		turns = (left + amount - 1) / amount;
+	}
+
+	if (p->csp < p->msp) {
+		s32b left = ((s32b)(p->msp - p->csp) << 16) - p->csp_frac;
+		s32b amount = player_regen_mana_amount(p);
+		int mana_turns = (left + amount - 1) / amount;
+		if (turns < 0 || mana_turns < turns)
+			turns = mana_turns;
+	}
+
+	return turns;
+}
+
+/**
+ * Regenerate as if by `turns` world ticks at once, which must be fewer than
+ * player_regen_turns() so that nothing fills up.
+ */
+void player_regen_many(struct player *p, int turns)
+{
+	if (p->chp < p->mhp) {
+		s32b total = ((s32b)p->chp << 16) + p->chp_frac +
+			turns * player_regen_hp_amount(p);
+		int old_chp = p->chp;
+
+		p->chp = (s16b)(total >> 16);
+		p->chp_frac = (u16b)(total & 0xFFFF);
+		if (old_chp != p->chp) {
+			p->upkeep->redraw |= (PR_HP);
+			equip_learn_flag(p, OF_REGEN);
+			equip_learn_flag(p, OF_IMPAIR_HP);
+		}
+	}
+
+	if (p->csp < p->msp) {
+		s32b total = ((s32b)p->csp << 16) + p->csp_frac +
+			turns * player_regen_mana_amount(p);
+		int old_csp = p->csp;
+
+		p->csp = (s16b)(total >> 16);
+		p->csp_frac = (u16b)(total & 0xFFFF);
+		if (old_csp != p->csp) {
+			p->upkeep->redraw |= (PR_MANA);
+			equip_learn_flag(p, OF_REGEN);
+			equip_learn_flag(p, OF_IMPAIR_MANA);
+		}
+	}
+}
+
+/**
+ * Return the light the player is using up fuel in, if any
+ */
+struct object *player_light_burning(struct player *p)
 {
 	/* Check for light being wielded */
 	struct object *obj = equipped_item_by_slot_name(p, "light");
 
+	if (!obj || !tval_is_light(obj))
+		return NULL;
+
+	/* Turn off the wanton burning of light during the day in the town */
+	if (!p->depth && is_daytime())
+		return NULL;
+
+	/* If the light has the NO_FUEL flag, well... */
+	if (of_has(obj->flags, OF_NO_FUEL))
+		return NULL;
+
+	return obj->timeout > 0 ? obj : NULL;
+}
+
+/**
+ * Update the player's light fuel
+ */
+void player_update_light(struct player *p)
+{
+	struct object *obj = player_light_burning(p);
+
 	/* Burn some fuel in the current light */
-	if (obj && tval_is_light(obj)) {
-		bool burn_fuel = true;
-
-		/* Turn off the wanton burning of light during the day in the town */
-		if (!p->depth && is_daytime())
-			burn_fuel = false;
-
-		/* If the light has the NO_FUEL flag, well... */
-		if (of_has(obj->flags, OF_NO_FUEL))
-		    burn_fuel = false;
-
-		/* Use some fuel (except on artifacts, or during the day) */
-		if (burn_fuel && obj->timeout > 0) {
-			/* Decrease life-span */
-			obj->timeout--;
-
-			/* Hack -- notice interesting fuel steps */
-			if ((obj->timeout < 100) || (!(obj->timeout % 100)))
-				/* Redraw stuff */
-				p->upkeep->redraw |= (PR_EQUIP);
-
-			/* Hack -- Special treatment when blind */
-			if (p->timed[TMD_BLIND]) {
-				/* Hack -- save some light for later */
-				if (obj->timeout == 0) obj->timeout++;
-			} else if (obj->timeout == 0) {
-				/* The light is now out */
-				disturb(p, 0);
-				msg("Your light has gone out!");
-
-				/* If it's a torch, now is the time to delete it */
-				if (of_has(obj->flags, OF_BURNS_OUT)) {
-					bool dummy;
-					struct object *burnt = gear_object_for_use(obj, 1, false,
-															   &dummy);
-					if (burnt->known)
-						object_delete(&burnt->known);
-					object_delete(&burnt);
-				}
-			} else if ((obj->timeout < 50) && (!(obj->timeout % 20))) {
-				/* The light is getting dim */
-				disturb(p, 0);
-				msg("Your light is growing faint.");
+	if (obj) {
+		/* Decrease life-span */
+		obj->timeout--;
+
+		/* Hack -- notice interesting fuel steps */
+		if ((obj->timeout < 100) || (!(obj->timeout % 100)))
+			/* Redraw stuff */
+			p->upkeep->redraw |= (PR_EQUIP);
+
+		/* Hack -- Special treatment when blind */
+		if (p->timed[TMD_BLIND]) {
+			/* Hack -- save some light for later */
+			if (obj->timeout == 0) obj->timeout++;
+		} else if (obj->timeout == 0) {
+			/* The light is now out */
+			disturb(p, 0);
+			msg("Your light has gone out!");
+
+			/* If it's a torch, now is the time to delete it */
+			if (of_has(obj->flags, OF_BURNS_OUT)) {
+				bool dummy;
+				struct object *burnt = gear_object_for_use(obj, 1, false,
+														   &dummy);
+				if (burnt->known)
+					object_delete(&burnt->known);
+				object_delete(&burnt);
 			}
+		} else if ((obj->timeout < 50) && (!(obj->timeout % 20))) {
+			/* The light is getting dim */
+			disturb(p, 0);
+			msg("Your light is growing faint.");
 		}
 	}
 
@@ -775,6 +863,51 @@ void player_resting_step_turn(struct player *p)
 	player_turns_rested++;
 }
 
+/**
+ * Perform a number of turns of resting at once, except for taking the turns
+ * themselves.  The count must not run out.
+ */
+void player_resting_step_turns(struct player *p, int turns)
+{
+	/* Timed rest */
+	if (p->upkeep->resting > 0) {
+		assert(p->upkeep->resting > turns);
+
+		/* Reduce rest count */
+		p->upkeep->resting -= turns;
+
+		/* Redraw the state */
+		p->upkeep->redraw |= (PR_STATE);
+	}
+
+	/* Increment the resting counters */
+	p->resting_turn += turns;
+	player_turns_rested += turns;
+}
+
+/**
+ * Return true if a conditional rest (with one of the REST_ constants) has
+ * achieved what it set out to.
+ */
+bool player_resting_is_complete(struct player *p)
+{
+	if (p->upkeep->resting == REST_ALL_POINTS) {
+		return (p->chp == p->mhp) && (p->csp == p->msp);
+	} else if (p->upkeep->resting == REST_COMPLETE) {
+		return (p->chp == p->mhp) && (p->csp == p->msp) &&
+			!p->timed[TMD_BLIND] && !p->timed[TMD_CONFUSED] &&
+			!p->timed[TMD_POISONED] && !p->timed[TMD_AFRAID] &&
+			!p->timed[TMD_TERROR] && !p->timed[TMD_STUN] &&
+			!p->timed[TMD_CUT] && !p->timed[TMD_SLOW] &&
+			!p->timed[TMD_PARALYZED] && !p->timed[TMD_IMAGE] &&
+			!p->word_recall && !p->deep_descent;
+	} else if (p->upkeep->resting == REST_SOME_POINTS) {
+		return (p->chp == p->mhp) || (p->csp == p->msp);
+	}
+
+	return false;
+}
+
 /**
  * Handle the conditions for conditional resting (resting with the REST_
  * constants).
@@ -782,27 +915,9 @@ void player_resting_step_turn(struct player *p)
 void player_resting_complete_special(struct player *p)
 {
 	/* Complete resting */
-	if (player_resting_is_special(p->upkeep->resting)) {
-		if (p->upkeep->resting == REST_ALL_POINTS) {
-			if ((p->chp == p->mhp) && (p->csp == p->msp))
-				/* Stop resting */
-				disturb(p, 0);
-		} else if (p->upkeep->resting == REST_COMPLETE) {
-			if ((p->chp == p->mhp) && (p->csp == p->msp) &&
-				!p->timed[TMD_BLIND] && !p->timed[TMD_CONFUSED] &&
-				!p->timed[TMD_POISONED] && !p->timed[TMD_AFRAID] &&
-				!p->timed[TMD_TERROR] && !p->timed[TMD_STUN] &&
-				!p->timed[TMD_CUT] && !p->timed[TMD_SLOW] &&
-				!p->timed[TMD_PARALYZED] && !p->timed[TMD_IMAGE] &&
-				!p->word_recall && !p->deep_descent)
-				/* Stop resting */
-				disturb(p, 0);
-		} else if (p->upkeep->resting == REST_SOME_POINTS) {
-			if ((p->chp == p->mhp) || (p->csp == p->msp))
-				/* Stop resting */
-				disturb(p, 0);
-		}
-	}
+	if (player_resting_is_complete(p))
+		/* Stop resting */
+		disturb(p, 0);
 }
 
 /* Record the player's last rest count for repeating */
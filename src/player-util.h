@@ -53,6 +53,9 @@ void death_knowledge(struct player *p);
 s16b modify_stat_value(int value, int amount);
 void player_regen_hp(struct player *p);
 void player_regen_mana(struct player *p);
+int player_regen_turns(struct player *p);
+void player_regen_many(struct player *p, int turns);
+struct object *player_light_burning(struct player *p);
 void player_update_light(struct player *p);
 bool player_can_cast(struct player *p, bool show_msg);
 bool player_can_study(struct player *p, bool show_msg);
@@ -73,6 +76,8 @@ void player_resting_set_count(struct player *p, s16b count);
 void player_resting_cancel(struct player *p, bool disturb);
 bool player_resting_can_regenerate(struct player *p);
 void player_resting_step_turn(struct player *p);
+void player_resting_step_turns(struct player *p, int turns);
+bool player_resting_is_complete(struct player *p);
 void player_resting_complete_special(struct player *p);
 int player_get_resting_repeat_count(struct player *p);
 void player_set_resting_repeat_count(struct player *p, s16b count);
@@ -22,6 +22,7 @@
 #include "init.h"
 #include "mon-lore.h"
 #include "mon-make.h"
+#include "mon-move.h"
 #include "monster.h"
 #include "object.h"
 #include "obj-knowledge.h"
@@ -187,10 +188,12 @@ static void wr_item(const struct object *obj)
 /**
  * Write a monster record (including held or mimicked objects)
  */
-static void wr_monster(const struct monster *mon)
+static void wr_monster(struct chunk *c, const struct monster *mon)
 {
 	size_t j;
 	struct object *obj = mon->held_obj; 
+	bitflag mflag[MFLAG_SIZE];
+	struct monster_known *known = cave_monster_known(c, mon->midx);
 	struct object *dummy = object_new();
 
 	wr_s16b(mon->race->ridx);
@@ -205,14 +208,18 @@ static void wr_monster(const struct monster *mon)
 	for (j = 0; j < MON_TMD_MAX; j++)
 		wr_s16b(mon->m_timed[j]);
 
+	/* Save whether the monster has been processed this turn as a flag */
+	mflag_copy(mflag, mon->mflag);
+	if (monster_is_handled(mon))
+		mflag_on(mflag, MFLAG_HANDLED);
 	for (j = 0; j < MFLAG_SIZE; j++)
-		wr_byte(mon->mflag[j]);
+		wr_byte(mflag[j]);
 
 	for (j = 0; j < OF_SIZE; j++)
-		wr_byte(mon->known_pstate.flags[j]);
+		wr_byte(known->flags[j]);
 
 	for (j = 0; j < ELEM_MAX; j++)
-		wr_s16b(mon->known_pstate.el_info[j].res_level);
+		wr_s16b(known->res_level[j]);
 
 	/* Write mimicked object marker, if any */
 	if (mon->mimicked_obj) {
@@ -858,7 +865,7 @@ static void wr_monsters_aux(struct chunk *c)
 	for (i = 1; i < cave_monster_max(c); i++) {
 		const struct monster *mon = cave_monster(c, i);
 
-		wr_monster(mon);
+		wr_monster(c, mon);
 	}
 }
 
@@ -1362,19 +1362,67 @@ static void store_maint(struct store *s)
 	}
 }
 
+/**
+ * The number of days of maintenance after which a store's stock is as good
+ * as a fresh one; by then anything it held before (including whatever the
+ * player sold it) has been sold off, except with negligible probability.
+ */
+static int store_turnover_horizon(const struct store *s)
+{
+	return 50 * (s->normal_stock_max + s->always_num) / s->turnover;
+}
+
+/**
+ * Replace the stock of a store with a fresh one, as after many days of
+ * maintenance.
+ */
+static void store_restock(struct store *s)
+{
+	int i;
+
+	/* Sell off everything */
+	while (s->stock) {
+		struct object *obj = s->stock;
+
+		if (obj->artifact)
+			history_lose_artifact(player, obj->artifact);
+		store_delete(s, obj, obj->number);
+	}
+
+	/* Stock up as at the start of the game */
+	for (i = 0; i < 10; i++)
+		store_maint(s);
+}
+
 /**
  * Update the stores on the return to town.
+ *
+ * After a long enough absence a store's stock no longer depends on what it
+ * was, so rather than maintaining it day by day it is just restocked.
  */
 void store_update(void)
 {
+	bool restocked[MAX_STORES] = { false };
+	int n;
+
 	if (OPT(player, cheat_xtra)) msg("Updating Shops...");
-	while (daycount--) {
-		int n;
 
+	/* Restock the shops which have been left long enough */
+	for (n = 0; n < MAX_STORES; n++) {
+		struct store *s = &stores[n];
+
+		if (n == STORE_HOME || !s->turnover) continue;
+		if (daycount <= store_turnover_horizon(s)) continue;
+
+		store_restock(s);
+		restocked[n] = true;
+	}
+
+	while (daycount--) {
 		/* Maintain each shop (except home) */
 		for (n = 0; n < MAX_STORES; n++) {
-			/* Skip the home */
-			if (n == STORE_HOME) continue;
+			/* Skip the home, and shops already restocked */
+			if (n == STORE_HOME || restocked[n]) continue;
 
 			/* Maintain */
 			store_maint(&stores[n]);
@@ -35,9 +35,9 @@
 static bool target_set;
 
 /**
- * Current monster being tracked, or 0
+ * Current monster being tracked, or a handle with index 0
  */
-static struct monster *target_who;
+static struct monster_handle target_who;
 
 /**
  * Target location
@@ -149,11 +149,13 @@ bool target_okay(void)
 	if (!target_set) return false;
 
 	/* Check "monster" targets */
-	if (target_who) {
-		if (target_able(target_who)) {
+	if (target_who.idx) {
+		struct monster *mon = cave_monster_handle(cave, target_who);
+
+		if (mon && target_able(mon)) {
 			/* Get the monster location */
-			target_y = target_who->fy;
-			target_x = target_who->fx;
+			target_y = mon->fy;
+			target_x = mon->fx;
 
 			/* Good target */
 			return true;
@@ -176,7 +178,8 @@ bool target_set_monster(struct monster *mon)
 	/* Acceptable target */
 	if (mon && target_able(mon)) {
 		target_set = true;
-		target_who = mon;
+		target_who.idx = mon->midx;
+		target_who.gen = mon->gen;
 		target_y = mon->fy;
 		target_x = mon->fx;
 		return true;
@@ -184,7 +187,7 @@ bool target_set_monster(struct monster *mon)
 
 	/* Reset target info */
 	target_set = false;
-	target_who = NULL;
+	target_who.idx = 0;
 	target_y = 0;
 	target_x = 0;
 
@@ -201,7 +204,7 @@ void target_set_location(int y, int x)
 	if (square_in_bounds_fully(cave, y, x)) {
 		/* Save target info */
 		target_set = true;
-		target_who = NULL;
+		target_who.idx = 0;
 		target_y = y;
 		target_x = x;
 		return;
@@ -209,7 +212,7 @@ void target_set_location(int y, int x)
 
 	/* Reset target info */
 	target_set = false;
-	target_who = 0;
+	target_who.idx = 0;
 	target_y = 0;
 	target_x = 0;
 }
@@ -394,7 +397,7 @@ void target_get(int *x, int *y)
  */
 struct monster *target_get_monster(void)
 {
-	return target_who;
+	return cave_monster_handle(cave, target_who);
 }
 
 
@@ -407,8 +410,9 @@ bool target_sighted(void)
 			panel_contains(target_y, target_x) &&
 			 /* either the target is a grid and is visible, or it is a monster
 			  * that is visible */
-		((!target_who && square_isseen(cave, target_y, target_x)) ||
-			 (target_who && mflag_has(target_who->mflag, MFLAG_VISIBLE)));
+		((!target_who.idx && square_isseen(cave, target_y, target_x)) ||
+			 (target_who.idx &&
+			  mflag_has(target_get_monster()->mflag, MFLAG_VISIBLE)));
 }
 
 
@@ -0,0 +1,104 @@
+/* bench/alloc */
+
+#include "unit-bench.h"
+#include "test-utils.h"
+
+#include "cave.h"
+#include "cmd-core.h"
+#include "generate.h"
+#include "init.h"
+#include "mon-make.h"
+#include "obj-desc.h"
+#include "obj-knowledge.h"
+#include "obj-make.h"
+#include "obj-pile.h"
+#include "player.h"
+#include "z-rand.h"
+
+#define NUM_OBJECTS 64
+
+static struct object *objects[NUM_OBJECTS];
+
+static void println(const char *str) {
+}
+
+int setup_tests(void **state) {
+	int i;
+
+	plog_aux = println;
+	set_file_paths();
+	init_angband();
+
+	Rand_init();
+	Rand_state_init(1);
+
+	cmdq_push(CMD_BIRTH_INIT);
+	cmdq_push(CMD_BIRTH_RESET);
+	cmdq_push(CMD_CHOOSE_RACE);
+	cmd_set_arg_choice(cmdq_peek(), "choice", 0);
+	cmdq_push(CMD_CHOOSE_CLASS);
+	cmd_set_arg_choice(cmdq_peek(), "choice", 0);
+	cmdq_push(CMD_ROLL_STATS);
+	cmdq_push(CMD_NAME_CHOICE);
+	cmd_set_arg_string(cmdq_peek(), "name", "Tester");
+	cmdq_push(CMD_ACCEPT_CHARACTER);
+	cmdq_execute(CMD_BIRTH);
+
+	/* The town first, as the generators expect a current level */
+	cave_generate(&cave, player);
+	player->depth = 30;
+	cave_generate(&cave, player);
+
+	/* A spread of objects, known as the player would see them */
+	for (i = 0; i < NUM_OBJECTS; i++) {
+		struct object *obj;
+
+		do {
+			obj = make_object(cave, 30, i % 4 == 0, i % 16 == 0, false,
+							  NULL, 0);
+		} while (!obj);
+
+		obj->known = object_new();
+		object_set_base_known(obj);
+		player_know_object(player, obj);
+		objects[i] = obj;
+	}
+
+	return 0;
+}
+
+int teardown_tests(void **state) {
+	int i;
+
+	for (i = 0; i < NUM_OBJECTS; i++) {
+		object_delete(&objects[i]->known);
+		object_delete(&objects[i]);
+	}
+
+	cleanup_angband();
+	return 0;
+}
+
+static void bench_get_mon_num(void *state) {
+	bench_sink += (long)get_mon_num(30);
+}
+
+static void bench_get_obj_num(void *state) {
+	bench_sink += (long)get_obj_num(30, false, 0);
+}
+
+static void bench_object_desc(void *state) {
+	static int n;
+	char buf[80];
+
+	bench_sink += object_desc(buf, sizeof(buf), objects[n++ % NUM_OBJECTS],
+							  ODESC_PREFIX | ODESC_FULL);
+}
+
+const char *suite_name = "bench/alloc";
+struct bench benches[] = {
+	{ "get_mon_num", bench_get_mon_num },
+	{ "get_obj_num", bench_get_obj_num },
+	{ "object_desc", bench_object_desc },
+	{ NULL, NULL }
+};
@@ -0,0 +1,107 @@
+/* bench/cave */
+
+#include "unit-bench.h"
+#include "test-utils.h"
+
+#include "cave.h"
+#include "cmd-core.h"
+#include "generate.h"
+#include "init.h"
+#include "player.h"
+#include "project.h"
+#include "z-rand.h"
+
+#define NUM_PAIRS 256
+
+static struct loc from[NUM_PAIRS], to[NUM_PAIRS];
+
+static void println(const char *str) {
+}
+
+int setup_tests(void **state) {
+	int i;
+
+	plog_aux = println;
+	set_file_paths();
+	init_angband();
+
+	/* A fixed level, so results are comparable between runs */
+	Rand_init();
+	Rand_state_init(1);
+
+	cmdq_push(CMD_BIRTH_INIT);
+	cmdq_push(CMD_BIRTH_RESET);
+	cmdq_push(CMD_CHOOSE_RACE);
+	cmd_set_arg_choice(cmdq_peek(), "choice", 0);
+	cmdq_push(CMD_CHOOSE_CLASS);
+	cmd_set_arg_choice(cmdq_peek(), "choice", 0);
+	cmdq_push(CMD_ROLL_STATS);
+	cmdq_push(CMD_NAME_CHOICE);
+	cmd_set_arg_string(cmdq_peek(), "name", "Tester");
+	cmdq_push(CMD_ACCEPT_CHARACTER);
+	cmdq_execute(CMD_BIRTH);
+
+	/* The town first, as the generators expect a current level */
+	cave_generate(&cave, player);
+	player->depth = 10;
+	cave_generate(&cave, player);
+
+	/* Pairs of floor grids within sight range of each other */
+	for (i = 0; i < NUM_PAIRS; i++) {
+		int y1, x1, y2, x2;
+
+		do {
+			y1 = randint0(cave->height);
+			x1 = randint0(cave->width);
+		} while (!square_isfloor(cave, y1, x1));
+
+		do {
+			y2 = y1 + rand_range(-z_info->max_sight, z_info->max_sight);
+			x2 = x1 + rand_range(-z_info->max_sight, z_info->max_sight);
+		} while (!square_in_bounds(cave, y2, x2) ||
+				 !square_isfloor(cave, y2, x2));
+
+		from[i] = loc(x1, y1);
+		to[i] = loc(x2, y2);
+	}
+
+	return 0;
+}
+
+int teardown_tests(void **state) {
+	cleanup_angband();
+	return 0;
+}
+
+static void bench_los(void *state) {
+	static int n;
+	int i = n++ % NUM_PAIRS;
+
+	bench_sink += los(cave, from[i].y, from[i].x, to[i].y, to[i].x);
+}
+
+static void bench_project_path(void *state) {
+	static int n;
+	int i = n++ % NUM_PAIRS;
+	struct loc path[512];
+
+	bench_sink += project_path(path, z_info->max_range, from[i].y, from[i].x,
+							   to[i].y, to[i].x, PROJECT_STOP);
+}
+
+static void bench_cave_update_flow(void *state) {
+	cave_update_flow(cave);
+}
+
+static void bench_update_view(void *state) {
+	update_view(cave, player);
+}
+
+const char *suite_name = "bench/cave";
+struct bench benches[] = {
+	{ "los", bench_los },
+	{ "project_path", bench_project_path },
+	{ "cave_update_flow", bench_cave_update_flow },
+	{ "update_view", bench_update_view },
+	{ NULL, NULL }
+};
@@ -0,0 +1,94 @@
+/* bench/core */
+
+#include "unit-bench.h"
+#include "z-bitflag.h"
+#include "z-form.h"
+#include "z-quark.h"
+
+#define NUM_STRINGS 64
+#define FLAG_BYTES 16
+#define FLAG_COUNT (FLAG_BYTES * FLAG_WIDTH)
+
+static char strings[NUM_STRINGS][16];
+static bitflag flags1[FLAG_BYTES];
+static bitflag flags2[FLAG_BYTES];
+
+int setup_tests(void **state) {
+	int i;
+
+	quarks_init();
+
+	/* Half the strings are added up front, so quark_add() sees both hits
+	 * and new strings on the first pass */
+	for (i = 0; i < NUM_STRINGS; i++) {
+		strnfmt(strings[i], sizeof(strings[i]), "quark-%d", i);
+		if (i % 2) quark_add(strings[i]);
+	}
+
+	for (i = FLAG_START; i < (int) FLAG_COUNT; i += 3)
+		flag_on(flags1, FLAG_BYTES, i);
+	for (i = FLAG_START; i < (int) FLAG_COUNT; i += 5)
+		flag_on(flags2, FLAG_BYTES, i);
+
+	return 0;
+}
+
+int teardown_tests(void **state) {
+	quarks_free();
+	return 0;
+}
+
+static void bench_quark_add(void *state) {
+	static int n;
+	bench_sink += quark_add(strings[n++ % NUM_STRINGS]);
+}
+
+static void bench_flag_has(void *state) {
+	static int n;
+	bench_sink += flag_has(flags1, FLAG_BYTES, FLAG_START + n++ % (FLAG_COUNT - 1));
+}
+
+static void bench_flag_on_off(void *state) {
+	static int n;
+	int flag = FLAG_START + n++ % (FLAG_COUNT - 1);
+	bitflag f[FLAG_BYTES];
+
+	flag_copy(f, flags1, FLAG_BYTES);
+	flag_on(f, FLAG_BYTES, flag);
+	bench_sink += flag_off(f, FLAG_BYTES, flag);
+}
+
+static void bench_flag_union_inter(void *state) {
+	bitflag f[FLAG_BYTES];
+
+	flag_copy(f, flags1, FLAG_BYTES);
+	flag_union(f, flags2, FLAG_BYTES);
+	flag_inter(f, flags1, FLAG_BYTES);
+	bench_sink += flag_is_inter(f, flags2, FLAG_BYTES);
+}
+
+static void bench_flag_next(void *state) {
+	int flag;
+
+	for (flag = flag_next(flags2, FLAG_BYTES, FLAG_START); flag != FLAG_END;
+		 flag = flag_next(flags2, FLAG_BYTES, flag + 1))
+		bench_sink += flag;
+}
+
+static void bench_flag_is_empty(void *state) {
+	bitflag f[FLAG_BYTES];
+
+	flag_wipe(f, FLAG_BYTES);
+	bench_sink += flag_is_empty(f, FLAG_BYTES) + flag_is_empty(flags1, FLAG_BYTES);
+}
+
+const char *suite_name = "bench/core";
+struct bench benches[] = {
+	{ "quark_add", bench_quark_add },
+	{ "flag_has", bench_flag_has },
+	{ "flag_on_off", bench_flag_on_off },
+	{ "flag_union_inter", bench_flag_union_inter },
+	{ "flag_next", bench_flag_next },
+	{ "flag_is_empty", bench_flag_is_empty },
+	{ NULL, NULL }
+};
@@ -0,0 +1,82 @@
+/* bench/parse */
+
+#include "unit-bench.h"
+
+#include "parser.h"
+
+/* Lines in the style of the monster.txt data file */
+static const char *lines[] = {
+	"name:Grip, Farmer Maggot's Dog",
+	"base:canine",
+	"depth:2",
+	"speed:20",
+	"hit-points:5",
+	"blow:BITE:HURT:1d6",
+	"blow:CLAW:POISON:2d4",
+	"flags:UNIQUE | RAND_25",
+	"flags:DROP_1 | ONLY_ITEM",
+	"desc:A rather vicious dog belonging to Farmer Maggot.",
+	"# comment lines are skipped",
+	"",
+};
+
+static enum parser_error parse_name(struct parser *p) {
+	bench_sink += parser_getstr(p, "name")[0];
+	return PARSE_ERROR_NONE;
+}
+
+static enum parser_error parse_sym(struct parser *p) {
+	bench_sink += parser_getsym(p, "name")[0];
+	return PARSE_ERROR_NONE;
+}
+
+static enum parser_error parse_int(struct parser *p) {
+	bench_sink += parser_getint(p, "value");
+	return PARSE_ERROR_NONE;
+}
+
+static enum parser_error parse_blow(struct parser *p) {
+	bench_sink += parser_getsym(p, "method")[0];
+	if (parser_hasval(p, "damage"))
+		bench_sink += parser_getrand(p, "damage").dice;
+	return PARSE_ERROR_NONE;
+}
+
+static enum parser_error parse_flags(struct parser *p) {
+	if (parser_hasval(p, "flags"))
+		bench_sink += parser_getstr(p, "flags")[0];
+	return PARSE_ERROR_NONE;
+}
+
+int setup_tests(void **state) {
+	struct parser *p = parser_new();
+
+	parser_reg(p, "name str name", parse_name);
+	parser_reg(p, "base sym name", parse_sym);
+	parser_reg(p, "depth int value", parse_int);
+	parser_reg(p, "speed int value", parse_int);
+	parser_reg(p, "hit-points int value", parse_int);
+	parser_reg(p, "blow sym method ?sym effect ?rand damage", parse_blow);
+	parser_reg(p, "flags ?str flags", parse_flags);
+	parser_reg(p, "desc str name", parse_name);
+
+	*state = p;
+	return 0;
+}
+
+int teardown_tests(void *state) {
+	parser_destroy(state);
+	return 0;
+}
+
+static void bench_parser_parse(void *state) {
+	static int n;
+
+	bench_sink += parser_parse(state, lines[n++ % N_ELEMENTS(lines)]);
+}
+
+const char *suite_name = "bench/parse";
+struct bench benches[] = {
+	{ "parser_parse", bench_parser_parse },
+	{ NULL, NULL }
+};
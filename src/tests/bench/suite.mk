@@ -0,0 +1,4 @@
+BENCHPROGS += bench/alloc \
+	bench/cave \
+	bench/core \
+	bench/parse
@@ -0,0 +1,117 @@
+/* game/rest.c */
+
+#include "unit-test.h"
+#include "unit-test-data.h"
+#include "test-utils.h"
+
+#include <stdio.h>
+#include "cave.h"
+#include "cmd-core.h"
+#include "game-event.h"
+#include "game-world.h"
+#include "generate.h"
+#include "init.h"
+#include "mon-make.h"
+#include "mon-util.h"
+#include "player.h"
+#include "player-calcs.h"
+#include "player-util.h"
+#include "z-util.h"
+
+static int refreshes;
+
+static void event_refresh(game_event_type type, game_event_data *data, void *user) {
+	refreshes++;
+}
+
+static void println(const char *str) {
+	printf("%s\n", str);
+}
+
+int setup_tests(void **state) {
+	/* Register a basic error handler */
+	plog_aux = println;
+
+	/* Count the refreshes */
+	event_add_handler(EVENT_REFRESH, event_refresh, NULL);
+
+	/* Init the game */
+	set_file_paths();
+	init_angband();
+
+	/* Make a new character, and get them into the dungeon */
+	cmdq_push(CMD_BIRTH_INIT);
+	cmdq_push(CMD_BIRTH_RESET);
+	cmdq_push(CMD_CHOOSE_RACE);
+	cmd_set_arg_choice(cmdq_peek(), "choice", 0);
+
+	cmdq_push(CMD_CHOOSE_CLASS);
+	cmd_set_arg_choice(cmdq_peek(), "choice", 0);
+
+	cmdq_push(CMD_ROLL_STATS);
+	cmdq_push(CMD_NAME_CHOICE);
+	cmd_set_arg_string(cmdq_peek(), "name", "Tester");
+
+	cmdq_push(CMD_ACCEPT_CHARACTER);
+	cmdq_execute(CMD_BIRTH);
+
+	cave_generate(&cave, player);
+	on_new_level();
+	player->depth = 5;
+	cave_generate(&cave, player);
+	on_new_level();
+
+	return 0;
+}
+
+int teardown_tests(void *state) {
+	cleanup_angband();
+	return 0;
+}
+
+/* Resting must stay quick on a level where many monsters have died */
+int test_rest_freed(void *state) {
+	struct monster_race *race = lookup_monster("soldier ant");
+	int chance = z_info->alloc_monster_chance;
+	int i, y, x, start;
+
+	/* Fill the monster list well past the headroom bulk resting needs */
+	while (cave_monster_max(cave) < 100) {
+		require(find_empty(cave, &y, &x));
+		require(place_new_monster(cave, y, x, race, true, false, ORIGIN_DROP));
+	}
+
+	/* Then kill everything, leaving the slots free */
+	for (i = 1; i < cave_monster_max(cave); i++)
+		if (cave_monster(cave, i)->race)
+			delete_monster_idx(i);
+	eq(cave_monster_count(cave), 0);
+	require(cave_monster_max(cave) >= 100);
+
+	/* Rest off some damage, with no new monsters to come looking */
+	z_info->alloc_monster_chance = 30000;
+	player->chp = player->mhp / 5 + 1;
+	start = turn;
+	refreshes = 0;
+	cmdq_push(CMD_REST);
+	cmd_set_arg_choice(cmdq_peek(), "choice", REST_COMPLETE);
+	for (i = 0; i < 1000; i++) {
+		run_game_loop();
+		if (!player_is_resting(player))
+			break;
+	}
+	z_info->alloc_monster_chance = chance;
+
+	eq(player->is_dead, false);
+	eq(player->chp, player->mhp);
+
+	/* Most game turns should have passed without a refresh */
+	require(turn - start > 4 * refreshes);
+	ok;
+}
+
+const char *suite_name = "game/rest";
+struct test tests[] = {
+	{ "rest_freed", test_rest_freed },
+	{ NULL, NULL }
+};
@@ -1,2 +1,3 @@
 TESTPROGS += game/basic \
-	game/mage
+	game/mage \
+	game/rest
@@ -0,0 +1,243 @@
+/* unit-bench.c
+ *
+ * Framework for micro-benchmarks, run with "make bench"
+ *
+ * After a few warm-up rounds, each bench is timed over a number of rounds,
+ * each of which calls it often enough to take a measurable time.  The median
+ * and 95th percentile time per call across the rounds are reported.
+ *
+ * Settings are taken from the environment:
+ *   BENCH_ROUNDS     number of timed rounds (default 21)
+ *   BENCH_WARMUP     number of untimed rounds first (default 3)
+ *   BENCH_OUTPUT     directory to write the results into, as <suite>.json
+ *   BENCH_BASELINE   directory of earlier results to compare against
+ *   BENCH_THRESHOLD  percentage by which the median may exceed the baseline
+ *                    before it counts as a regression (default 10)
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "unit-test-types.h"
+#include "z-util.h"
+
+/* Shortest time a timed round may take, in nanoseconds */
+#define BENCH_ROUND_NS 2000000.0
+
+int verbose = 0;
+volatile long bench_sink;
+
+extern const char *suite_name;
+extern struct bench benches[];
+extern int setup_tests(void **data);
+extern int teardown_tests(void **data);
+
+static int env_int(const char *name, int def) {
+	char *s = getenv(name);
+	return (s && s[0]) ? atoi(s) : def;
+}
+
+static double now_ns(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double time_round(const struct bench *b, void *state, long calls) {
+	double start = now_ns();
+	long i;
+
+	for (i = 0; i < calls; i++)
+		b->func(state);
+
+	return now_ns() - start;
+}
+
+static int cmp_double(const void *a, const void *b) {
+	double x = *(const double *)a, y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+/**
+ * Build the results file name for this suite in directory dir.
+ */
+static void results_path(char *buf, size_t len, const char *dir) {
+	size_t i, start;
+
+	snprintf(buf, len, "%s/", dir);
+	start = strlen(buf);
+	snprintf(buf + start, len - start, "%s.json", suite_name);
+
+	/* "bench/core" is stored as "bench-core.json" */
+	for (i = start; buf[i]; i++)
+		if (buf[i] == '/') buf[i] = '-';
+}
+
+/**
+ * Read a whole results file, or return NULL if there isn't one.
+ */
+static char *read_results(const char *dir) {
+	char path[1024];
+	char *text;
+	long len;
+	FILE *f;
+
+	results_path(path, sizeof(path), dir);
+	f = fopen(path, "rb");
+	if (!f) return NULL;
+
+	fseek(f, 0, SEEK_END);
+	len = ftell(f);
+	fseek(f, 0, SEEK_SET);
+
+	text = malloc(len + 1);
+	if (text) {
+		len = fread(text, 1, len, f);
+		text[len] = '\0';
+	}
+
+	fclose(f);
+	return text;
+}
+
+/**
+ * Find the median recorded for a bench in results written by this harness.
+ */
+static int baseline_median(const char *results, const char *name,
+		double *median) {
+	char key[256];
+	const char *s;
+
+	snprintf(key, sizeof(key), "\"name\": \"%s\"", name);
+	s = strstr(results, key);
+	if (!s) return 0;
+
+	s = strstr(s, "\"median_ns\":");
+	if (!s) return 0;
+
+	*median = strtod(s + strlen("\"median_ns\":"), NULL);
+	return 1;
+}
+
+int main(int argc, char *argv[]) {
+	void *state;
+	int i, j;
+	int passed = 0;
+	int total = 0;
+
+	int rounds = env_int("BENCH_ROUNDS", 21);
+	int warmup = env_int("BENCH_WARMUP", 3);
+	int threshold = env_int("BENCH_THRESHOLD", 10);
+	char *output = getenv("BENCH_OUTPUT");
+	char *baseline_dir = getenv("BENCH_BASELINE");
+	char *baseline = NULL;
+	FILE *out = NULL;
+	double *samples;
+
+	char *s = getenv("VERBOSE");
+	if (s && s[0]) {
+		verbose = 1;
+	} else if (argc > 1 && !strncmp(argv[1], "-v", 2)) {
+		verbose = 1;
+	}
+
+	if (rounds < 1) rounds = 1;
+	samples = malloc(rounds * sizeof(*samples));
+
+	if (baseline_dir && baseline_dir[0])
+		baseline = read_results(baseline_dir);
+
+	if (output && output[0]) {
+		char path[1024];
+
+		results_path(path, sizeof(path), output);
+		out = fopen(path, "w");
+		if (!out) {
+			printf("ERROR: %s can't write %s\n", suite_name, path);
+			return 1;
+		}
+		fprintf(out, "{\n  \"suite\": \"%s\",\n  \"results\": [", suite_name);
+	}
+
+	if (setup_tests(&state)) {
+		printf("ERROR: %s setup failed\n", suite_name);
+		return 1;
+	}
+
+	printf("%s:\n", suite_name);
+
+	for (i = 0; benches[i].name; i++) {
+		const struct bench *b = &benches[i];
+		long calls = 1;
+		double t, median, p95, base;
+		int regressed = 0;
+
+		fflush(stdout);
+
+		/* Find how many calls make a round long enough to time */
+		while ((t = time_round(b, state, calls)) < BENCH_ROUND_NS &&
+			   calls < (1L << 30)) {
+			if (t < BENCH_ROUND_NS / 16)
+				calls *= 16;
+			else
+				calls = (long)(calls * BENCH_ROUND_NS / t) + 1;
+		}
+
+		for (j = 0; j < warmup; j++)
+			time_round(b, state, calls);
+
+		for (j = 0; j < rounds; j++)
+			samples[j] = time_round(b, state, calls) / calls;
+
+		qsort(samples, rounds, sizeof(*samples), cmp_double);
+		median = samples[rounds / 2];
+		p95 = samples[(rounds * 95 + 99) / 100 - 1];
+
+		printf("  %-24s %12.1f ns median %12.1f ns p95", b->name, median,
+			   p95);
+		if (verbose)
+			printf("  (%d x %ld calls, min %.1f, max %.1f)", rounds, calls,
+				   samples[0], samples[rounds - 1]);
+
+		if (baseline && baseline_median(baseline, b->name, &base) &&
+			base > 0) {
+			double change = (median - base) * 100.0 / base;
+
+			regressed = change > threshold;
+			printf("  %+6.1f%%%s", change, regressed ? " REGRESSED" : "");
+		}
+		printf("\n");
+
+		if (out)
+			fprintf(out, "%s\n    { \"name\": \"%s\", \"calls\": %ld, "
+					"\"median_ns\": %.1f, \"p95_ns\": %.1f }",
+					i ? "," : "", b->name, calls, median, p95);
+
+		if (!regressed) passed++;
+		total++;
+	}
+
+	if (teardown_tests(state)) {
+		printf("ERROR: %s teardown failed\n", suite_name);
+		return 1;
+	}
+
+	if (out) {
+		fprintf(out, "\n  ]\n}\n");
+		fclose(out);
+	}
+
+	free(baseline);
+	free(samples);
+
+	printf("%s finished: %d/%d passed\n", suite_name, passed, total);
+	return passed == total ? 0 : 2;
+}
+
+int showpass(void) {
+	return 0;
+}
+int showfail(void) {
+	return 1;
+}
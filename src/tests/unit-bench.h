@@ -0,0 +1,17 @@
+/* unit-bench.h */
+
+#ifndef UNIT_BENCH_H
+#define UNIT_BENCH_H
+
+#include "unit-test.h"
+
+/* Benchmark suites supply a list of benches instead of tests.  Each bench
+ * function runs the code being measured once; the harness decides how many
+ * times to call it.
+ */
+extern struct bench benches[];
+
+/* Keep a result alive so the compiler can't drop the code producing it. */
+extern volatile long bench_sink;
+
+#endif /* !UNIT_BENCH_H */
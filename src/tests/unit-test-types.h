@@ -12,4 +12,9 @@ struct test {
 	int (*func)(void *data);
 };
 
+struct bench {
+	const char *name;
+	void (*func)(void *data);
+};
+
 #endif /* !UNIT_TEST_TYPES_H */
@@ -150,11 +150,34 @@ int test_evaluate(void *state)
 	ok;
 }
 
+int test_fold(void *state)
+{
+	expression_t *new = expression_new();
+
+	/* Folded operations give the same results as the unfolded ones. */
+	expression_add_operations_string(new, "+ 7 - 3 + -4 2");
+	require(expression_evaluate(new) == 2);
+	expression_add_operations_string(new, "n n * 3 2 * 1");
+	require(expression_evaluate(new) == 12);
+	expression_add_operations_string(new, "/ 5 / 2");
+	require(expression_evaluate(new) == 1);
+	expression_add_operations_string(new, "- 1 + 1 n");
+	require(expression_evaluate(new) == -1);
+
+	/* Folding does not depend on the base value. */
+	expression_set_base_value(new, base_value_2);
+	require(expression_evaluate(new) == -6);
+
+	expression_free(new);
+	ok;
+}
+
 const char *suite_name = "z-expression/expression";
 struct test tests[] = {
 	{ "alloc", test_alloc },
 	{ "parse-success", test_parse_success },
 	{ "parse-failure", test_parse_failure },
 	{ "evaluate", test_evaluate },
+	{ "fold", test_fold },
 	{ NULL, NULL },
 };
@@ -274,6 +274,80 @@ void square_free_trap(struct chunk *c, int y, int x)
 	}
 }
 
+/**
+ * Remember a grid with timed out traps, so that they can be counted down
+ * without searching the whole level
+ */
+static void list_timed_trap(struct chunk *c, int y, int x)
+{
+	int i;
+
+	for (i = 0; i < c->trap_timed_num; i++)
+		if ((c->trap_timed[i].y == y) && (c->trap_timed[i].x == x))
+			return;
+
+	/* Extend the list */
+	if (c->trap_timed_num == c->trap_timed_max) {
+		c->trap_timed_max += 16;
+		c->trap_timed = mem_realloc(c->trap_timed,
+									c->trap_timed_max * sizeof(struct loc));
+	}
+
+	c->trap_timed[c->trap_timed_num].y = y;
+	c->trap_timed[c->trap_timed_num].x = x;
+	c->trap_timed_num++;
+}
+
+/**
+ * Find all the grids on a level with timed out traps
+ */
+void list_timed_traps(struct chunk *c)
+{
+	int y, x;
+
+	c->trap_timed_num = 0;
+	for (y = 0; y < c->height; y++) {
+		for (x = 0; x < c->width; x++) {
+			struct trap *trap;
+			for (trap = c->squares[y][x].trap; trap; trap = trap->next) {
+				if (trap->timeout) {
+					list_timed_trap(c, y, x);
+					break;
+				}
+			}
+		}
+	}
+}
+
+/**
+ * Count down the timeouts of disabled traps by the given number of turns,
+ * forgetting grids where there is nothing left to count
+ */
+void decrease_trap_timeouts(struct chunk *c, int turns)
+{
+	int i = 0;
+
+	while (i < c->trap_timed_num) {
+		int y = c->trap_timed[i].y, x = c->trap_timed[i].x;
+		struct trap *trap;
+		bool timed = false;
+
+		for (trap = c->squares[y][x].trap; trap; trap = trap->next) {
+			if (!trap->timeout) continue;
+			trap->timeout -= MIN(turns, trap->timeout);
+			if (trap->timeout)
+				timed = true;
+			else
+				square_light_spot(c, y, x);
+		}
+
+		if (timed)
+			i++;
+		else
+			c->trap_timed[i] = c->trap_timed[--c->trap_timed_num];
+	}
+}
+
 /**
  * Reveal some of the player traps in a square
  */
@@ -586,6 +660,9 @@ bool square_set_trap_timeout(struct chunk *c, int y, int x, bool domsg,
 		current_trap = next_trap;
     }
 
+	/* Count the timer down */
+	list_timed_trap(c, y, x);
+
     /* Refresh grids that the character can see */
     if (square_isseen(c, y, x))
 		square_light_spot(c, y, x);
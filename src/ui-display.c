@@ -2146,6 +2146,77 @@ static void show_splashscreen(game_event_type type, game_event_data *data,
  * ------------------------------------------------------------------------
  * Visual updates betweeen player turns.
  * ------------------------------------------------------------------------ */
+
+/**
+ * Presentation scheduling.
+ *
+ * The game loop asks for a refresh several times every game turn, far more
+ * often than anyone can see during runs, rests and repeated commands.  If
+ * frame_rate_max is set, refreshes closer together than that allows are not
+ * passed on to the frontend; if frame_defer_busy is set, none are passed on
+ * at all while the player is busy.  Anything skipped is picked up by the
+ * next frame that is presented, and since inkey() always flushes before
+ * waiting for a key, -more- prompts and the end of a run are never held back.
+ */
+u16b frame_rate_max = 0;
+bool frame_defer_busy = false;
+
+/**
+ * Clock time of the last presented frame, and whether the next one has to
+ * be presented regardless
+ */
+static clock_t frame_last;
+static bool frame_forced = true;
+
+/**
+ * Is the player doing something that takes many turns without input?
+ */
+static bool player_is_busy(void)
+{
+	return player->upkeep->running || player_is_resting(player) ||
+		cmd_get_nrepeats() > 0;
+}
+
+/**
+ * Decide whether a requested refresh should be presented now.
+ *
+ * clock() measures processor time on some systems, but the game is CPU-bound
+ * whenever refreshes come thick and fast, so it does for a frame limiter.
+ */
+static bool frame_due(void)
+{
+	clock_t now;
+
+	if (frame_forced) {
+		frame_forced = false;
+		frame_last = clock();
+		return true;
+	}
+
+	if (frame_defer_busy && player_is_busy())
+		return false;
+
+	if (!frame_rate_max)
+		return true;
+
+	now = clock();
+	if (now - frame_last < CLOCKS_PER_SEC / frame_rate_max)
+		return false;
+
+	frame_last = now;
+	return true;
+}
+
+/**
+ * Make sure the next refresh gets to the screen, because the player has
+ * been disturbed.
+ */
+static void force_frame(game_event_type type, game_event_data *data,
+						void *user)
+{
+	frame_forced = true;
+}
+
 static void refresh(game_event_type type, game_event_data *data, void *user)
 {
 	/* Place cursor on player/target */
@@ -2155,6 +2226,10 @@ static void refresh(game_event_type type, game_event_data *data, void *user)
 		move_cursor_relative(row, col);
 	}
 
+	/* Coalesce frames */
+	if (!frame_due())
+		return;
+
 	Term_fresh();
 }
 
@@ -2437,6 +2512,9 @@ static void ui_enter_world(game_event_type type, game_event_data *data,
 	/* Refresh the screen and put the cursor in the appropriate place */
 	event_add_handler(EVENT_REFRESH, refresh, NULL);
 
+	/* Show disturbances straight away */
+	event_add_handler(EVENT_INPUT_FLUSH, force_frame, NULL);
+
 	/* Do the visual updates required on a new dungeon level */
 	event_add_handler(EVENT_NEW_LEVEL_DISPLAY, new_level_display_update, NULL);
 
@@ -2498,6 +2576,7 @@ static void ui_leave_world(game_event_type type, game_event_data *data,
 
 	/* Refresh the screen and put the cursor in the appropriate place */
 	event_remove_handler(EVENT_REFRESH, refresh, NULL);
+	event_remove_handler(EVENT_INPUT_FLUSH, force_frame, NULL);
 
 	/* Do the visual updates required on a new dungeon level */
 	event_remove_handler(EVENT_NEW_LEVEL_DISPLAY, new_level_display_update, NULL);
@@ -26,6 +26,8 @@
 extern const char *stat_names[STAT_MAX];
 extern const char *stat_names_reduced[STAT_MAX];
 extern const char *window_flag_desc[32];
+extern u16b frame_rate_max;
+extern bool frame_defer_busy;
 
 byte monster_health_attr(void);
 void cnv_stat(int val, char *out_val, size_t out_len);
@@ -19,12 +19,90 @@
 #include "angband.h"
 #include "init.h"
 #include "mon-lore.h"
+#include "obj-gear.h"
+#include "player-attack.h"
 #include "ui-mon-lore.h"
 #include "ui-output.h"
 #include "ui-prefs.h"
 #include "ui-term.h"
 #include "z-textblock.h"
 
+/**
+ * The monster recall last drawn in a subwindow, and the key describing
+ * everything it was built from; the recall is reused until the key changes.
+ */
+static textblock *recall_tb;
+static byte *recall_key;
+static size_t recall_key_len;
+
+/**
+ * Copy size bytes of data into a recall key at *offset, and advance it.
+ */
+static void recall_key_add(byte *key, size_t *offset, const void *data,
+						   size_t size)
+{
+	memcpy(key + *offset, data, size);
+	*offset += size;
+}
+
+/**
+ * Build the key for the recall of a race.
+ *
+ * The key holds the race's lore (including blow knowledge), the attack
+ * colours and every piece of player or display state the description reads,
+ * so any change to what lore_description() would produce changes the key.
+ *
+ * \param race is the monster race we are describing.
+ * \param lore is the known information about the monster race.
+ * \param len is set to the length of the key.
+ * \return the key, which the caller must free.
+ */
+static byte *recall_key_make(const struct monster_race *race,
+							 const struct monster_lore *lore, size_t *len)
+{
+	struct object *weapon = equipped_item_by_slot_name(player, "weapon");
+	int spell_colors[RSF_MAX];
+	int *melee_colors = mem_zalloc(z_info->blow_effects_max * sizeof(int));
+	int values[] = {
+		race->ridx,
+		race->max_num,
+		player->lev,
+		player->max_depth,
+		py_attack_hit_chance(player, weapon),
+		OPT(player, cheat_know),
+		OPT(player, purple_uniques),
+		monster_x_attr[race->ridx],
+		monster_x_char[race->ridx],
+		tile_width,
+		tile_height,
+	};
+	size_t blows_size = z_info->mon_blows_max * sizeof(struct monster_blow);
+	size_t known_size = z_info->mon_blows_max * sizeof(bool);
+	size_t offset = 0;
+	byte *key;
+
+	get_attack_colors(melee_colors, spell_colors);
+
+	*len = sizeof(values) + sizeof(*lore) + sizeof(spell_colors) +
+		z_info->blow_effects_max * sizeof(int);
+	if (lore->blows) *len += blows_size;
+	if (lore->blow_known) *len += known_size;
+
+	key = mem_alloc(*len);
+	recall_key_add(key, &offset, values, sizeof(values));
+	recall_key_add(key, &offset, lore, sizeof(*lore));
+	recall_key_add(key, &offset, spell_colors, sizeof(spell_colors));
+	recall_key_add(key, &offset, melee_colors,
+				   z_info->blow_effects_max * sizeof(int));
+	if (lore->blows)
+		recall_key_add(key, &offset, lore->blows, blows_size);
+	if (lore->blow_known)
+		recall_key_add(key, &offset, lore->blow_known, known_size);
+
+	mem_free(melee_colors);
+	return key;
+}
+
 /**
  * Place a monster recall title into a textblock.
  *
@@ -196,7 +274,8 @@ void lore_show_subwindow(const struct monster_race *race,
 						 const struct monster_lore *lore)
 {
 	int y;
-	textblock *tb;
+	size_t key_len;
+	byte *key;
 
 	assert(race && lore);
 
@@ -205,9 +284,33 @@ void lore_show_subwindow(const struct monster_race *race,
 	for (y = 0; y < Term->hgt; y++)
 		Term_erase(0, y, 255);
 
-	tb = textblock_new();
-	lore_description(tb, race, lore, false);
-	textui_textblock_place(tb, SCREEN_REGION, NULL);
-	textblock_free(tb);
+	/* Only describe the monster again if something it depends on changed */
+	key = recall_key_make(race, lore, &key_len);
+	if (!recall_tb || key_len != recall_key_len ||
+		memcmp(key, recall_key, key_len)) {
+		if (recall_tb) textblock_free(recall_tb);
+		recall_tb = textblock_new();
+		lore_description(recall_tb, race, lore, false);
+
+		mem_free(recall_key);
+		recall_key = key;
+		recall_key_len = key_len;
+	} else {
+		mem_free(key);
+	}
+
+	textui_textblock_place(recall_tb, SCREEN_REGION, NULL);
+}
+
+/**
+ * Free the cached subwindow recall.
+ */
+void lore_show_cleanup(void)
+{
+	if (recall_tb) textblock_free(recall_tb);
+	recall_tb = NULL;
+	mem_free(recall_key);
+	recall_key = NULL;
+	recall_key_len = 0;
 }
 
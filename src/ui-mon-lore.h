@@ -26,5 +26,6 @@ void lore_show_interactive(const struct monster_race *race,
 						   const struct monster_lore *lore);
 void lore_show_subwindow(const struct monster_race *race,
 						 const struct monster_lore *lore);
+void lore_show_cleanup(void);
 
 #endif /* UI_MONSTER_LORE_H */
@@ -973,6 +973,41 @@ static void do_cmd_lazymove_delay(const char *name, int row)
 }
 
 
+/**
+ * Set the presentation frame rate limit
+ */
+static void do_cmd_frame_rate(const char *name, int row)
+{
+	char tmp[4] = "";
+	struct keypress ch;
+
+	strnfmt(tmp, sizeof(tmp), "%i", frame_rate_max);
+
+	screen_save();
+
+	/* Prompt */
+	prt("Command: Maximum Frame Rate", 20, 0);
+
+	prt(format("Current maximum frame rate: %d per second (0 for no limit)",
+			   frame_rate_max), 22, 0);
+	prt("New maximum frame rate: ", 21, 0);
+
+	/* Ask for a numeric value */
+	if (askfor_aux(tmp, sizeof(tmp), askfor_aux_numbers))
+		frame_rate_max = (u16b) strtoul(tmp, NULL, 0);
+
+	/* Ask about busy commands */
+	prt(format("Defer redraws while running or resting? [y/n] (currently %s) ",
+			   frame_defer_busy ? "yes" : "no"), 21, 0);
+	ch = inkey();
+	if (ch.code == 'y' || ch.code == 'Y')
+		frame_defer_busy = true;
+	else if (ch.code == 'n' || ch.code == 'N')
+		frame_defer_busy = false;
+
+	screen_load();
+}
+
 
 /**
  * Ask for a "user pref file" and process it.
@@ -1794,6 +1829,7 @@ static menu_action option_actions[] =
 	{ 0, 'd', "Set base delay factor", do_cmd_delay },
 	{ 0, 'h', "Set hitpoint warning", do_cmd_hp_warn },
 	{ 0, 'm', "Set movement delay", do_cmd_lazymove_delay },
+	{ 0, 'f', "Set maximum frame rate", do_cmd_frame_rate },
 	{ 0, 0, NULL, NULL },
 	{ 0, 's', "Save subwindow setup to pref file", do_dump_options },
 	{ 0, 't', "Save autoinscriptions to pref file", do_dump_autoinsc },
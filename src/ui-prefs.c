@@ -345,6 +345,11 @@ void option_dump(ang_file *fff)
 			file_putf(fff, "\n");
 		}
 	}
+
+	/* Dump the presentation limits */
+	file_putf(fff, "# Maximum frame rate, and whether to defer frames while busy\n");
+	file_putf(fff, "frame-rate:%d:%d\n\n", frame_rate_max,
+			  frame_defer_busy ? 1 : 0);
 }
 
 /**
@@ -1036,6 +1041,19 @@ static enum parser_error parse_prefs_window(struct parser *p)
 	return PARSE_ERROR_NONE;
 }
 
+static enum parser_error parse_prefs_frame_rate(struct parser *p)
+{
+	struct prefs_data *d = parser_priv(p);
+	assert(d != NULL);
+	if (d->bypass) return PARSE_ERROR_NONE;
+
+	frame_rate_max = (u16b) parser_getuint(p, "rate");
+	if (parser_hasval(p, "defer"))
+		frame_defer_busy = parser_getuint(p, "defer") ? true : false;
+
+	return PARSE_ERROR_NONE;
+}
+
 enum parser_error parse_prefs_dummy(struct parser *p)
 {
 	return PARSE_ERROR_NONE;
@@ -1068,6 +1086,7 @@ static struct parser *init_parse_prefs(bool user)
 	parser_reg(p, "message sym type sym attr", parse_prefs_message);
 	parser_reg(p, "color uint idx int k int r int g int b", parse_prefs_color);
 	parser_reg(p, "window int window uint flag uint value", parse_prefs_window);
+	parser_reg(p, "frame-rate uint rate ?uint defer", parse_prefs_frame_rate);
 	register_sound_pref_parser(p);
 
 	return p;
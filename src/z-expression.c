@@ -22,7 +22,7 @@
 
 struct expression_operation_s {
 	byte operator;
-	s16b operand;
+	s32b operand;
 };
 
 struct expression_s {
@@ -248,11 +248,49 @@ s32b expression_evaluate(expression_t const * const expression)
 
 /**
  * Add an operation to an expression, allocating more memory as needed.
+ *
+ * Operations are folded into the previous one where the result is the same
+ * for any base value: runs of additions and subtractions become one addition,
+ * runs of multiplications one multiplication, double negations cancel and
+ * identities are dropped.  This keeps the list evaluated every time the
+ * expression is used as short as possible.
  */
 static void expression_add_operation(expression_t *expression,
-									 const expression_operation_t operation)
+									 expression_operation_t operation)
 {
-	size_t count = 0;
+	expression_operation_t *last = NULL;
+
+	if (operation.operator == OPERATOR_SUB) {
+		operation.operator = OPERATOR_ADD;
+		operation.operand = -operation.operand;
+	}
+
+	/* Identities */
+	if (operation.operator == OPERATOR_ADD && operation.operand == 0)
+		return;
+	if ((operation.operator == OPERATOR_MUL ||
+		 operation.operator == OPERATOR_DIV) && operation.operand == 1)
+		return;
+
+	if (expression->operation_count > 0)
+		last = &expression->operations[expression->operation_count - 1];
+
+	if (last && last->operator == operation.operator) {
+		switch (operation.operator) {
+			case OPERATOR_ADD:
+				last->operand += operation.operand;
+				if (last->operand == 0) expression->operation_count--;
+				return;
+			case OPERATOR_MUL:
+				last->operand *= operation.operand;
+				return;
+			case OPERATOR_NEG:
+				expression->operation_count--;
+				return;
+			default:
+				break;
+		}
+	}
 
 	if (expression->operation_count >= expression->operations_size) {
 		expression->operations_size += EXPRESSION_ALLOC_SIZE;
@@ -261,7 +299,6 @@ static void expression_add_operation(expression_t *expression,
 
 	expression->operations[expression->operation_count] = operation;
 	expression->operation_count++;
-	count++;
 }
 
 /**
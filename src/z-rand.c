@@ -150,6 +150,35 @@ void Rand_init(void)
 }
 
 
+/**
+ * Save the RNG state
+ */
+void Rand_state_save(rand_state *s)
+{
+	s->quick = Rand_quick;
+	s->value = Rand_value;
+	s->state_i = state_i;
+	memcpy(s->state, STATE, sizeof(s->state));
+	s->z0 = z0;
+	s->z1 = z1;
+	s->z2 = z2;
+}
+
+/**
+ * Restore a saved RNG state
+ */
+void Rand_state_restore(const rand_state *s)
+{
+	Rand_quick = s->quick;
+	Rand_value = s->value;
+	state_i = s->state_i;
+	memcpy(STATE, s->state, sizeof(STATE));
+	z0 = s->z0;
+	z1 = s->z1;
+	z2 = s->z2;
+}
+
+
 /**
  * Extract a "random" number from 0 to m - 1, via division.
  *
@@ -49,6 +49,17 @@ typedef struct random {
  */
 #define RAND_DEG 32
 
+/**
+ * A copy of the state of both RNGs, so that a look-ahead can be undone.
+ */
+typedef struct rand_state {
+	bool quick;
+	u32b value;
+	u32b state_i;
+	u32b state[RAND_DEG];
+	u32b z0, z1, z2;
+} rand_state;
+
 /**
  * Random aspects used by damcalc, m_bonus_calc, and ranvals
  */
@@ -119,6 +130,16 @@ void Rand_state_init(u32b seed);
  */
 void Rand_init(void);
 
+/**
+ * Save the current RNG state into `s`.
+ */
+void Rand_state_save(rand_state *s);
+
+/**
+ * Put the RNG back into the state saved in `s`.
+ */
+void Rand_state_restore(const rand_state *s);
+
 /**
  * Generates a random unsigned long integer X where "0 <= X < M" holds.
  *